@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+/* Timing helper shared by the benchmarks */
+
+/// @brief Result of timing a repeated call
+struct Timing {
+    /// @brief Average time of one call (ns)
+    double ns_per_op;
+
+    /// @brief Number of timed calls
+    std::size_t reps;
+};
+
+/// @brief Time a call by repeating it at least `min_reps` times and until at least `min_time_ms` has passed
+/// @param fn Call to time
+/// @param min_time_ms Minimum total time (ms)
+/// @param min_reps Minimum number of calls
+template <typename FUNC>
+Timing timeRepeated(FUNC&& fn, double min_time_ms, std::size_t min_reps = 1) {
+    std::size_t reps = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto now = start;
+    do {
+        fn();
+        ++reps;
+        now = std::chrono::steady_clock::now();
+    } while (reps < min_reps || std::chrono::duration<double, std::milli>(now - start).count() < min_time_ms);
+    return Timing{std::chrono::duration<double, std::nano>(now - start).count() / reps, reps};
+}
+
+/// @brief Average time (ns) of a call, repeated until at least `min_time_ms` has passed
+template <typename FUNC>
+double nsPerOp(FUNC&& fn, double min_time_ms = 200.0, std::size_t min_reps = 1) {
+    return timeRepeated(fn, min_time_ms, min_reps).ns_per_op;
+}
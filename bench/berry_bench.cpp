@@ -0,0 +1,395 @@
+#include "berry/Polynomial.h"
+#include "berry/BernsteinTransform.h"
+#include "berry/Operations.h"
+
+#include "Timing.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace BRY;
+
+/* Benchmarks the core polynomial operations over DIM = 1, ..., 6 and a range of degrees. Usage:
+    berry_bench [--filter <substring>] [--min-time <ms>] [--json <file>] [--baseline <file>] [--threshold <percent>]
+    --json writes the results as JSON, and --baseline compares the results against a JSON file written by an earlier run. The exit
+    code is 1 if any benchmark is slower than the baseline by more than the threshold (default 10%)
+*/
+
+/* Largest number of coefficients of any polynomial created by a benchmark */
+constexpr bry_int_t max_coefficients = 1 << 20;
+
+/* Largest number of coefficients of a polynomial transformed with a dense (n^DIM x n^DIM) matrix */
+constexpr bry_int_t max_dense_coefficients = 1024;
+
+/* Allocation counters (all threads). The system allocator is wrapped on glibc, otherwise only `operator new` is counted */
+static std::atomic<std::size_t> s_allocations{0};
+static std::atomic<std::size_t> s_bytes_allocated{0};
+
+static void countAllocation(std::size_t bytes) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+#if defined(__GLIBC__)
+
+extern "C" {
+
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t n, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+
+void* malloc(std::size_t size) {
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size) {
+    countAllocation(n * size);
+    return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size) {
+    countAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) {
+    countAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size) {
+    countAllocation(size);
+    *ptr = __libc_memalign(alignment, size);
+    return *ptr ? 0 : ENOMEM;
+}
+
+}
+
+#else
+
+void* operator new(std::size_t size) {
+    countAllocation(size);
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif
+
+struct Options {
+    std::string filter;
+    double min_time_ms = 100.0;
+    std::string json_file;
+    std::string baseline_file;
+    double threshold = 10.0;
+};
+
+struct Result {
+    std::string name;
+    std::size_t dim;
+    bry_int_t degree;
+    double ns_per_op;
+    double allocations_per_op;
+    double bytes_per_op;
+
+    /// @brief Coefficients (or points) processed per second
+    double throughput;
+
+    std::string key() const {
+        return name + "/" + std::to_string(dim) + "/" + std::to_string(degree);
+    }
+};
+
+struct Measurement {
+    double ns_per_op;
+    double allocations_per_op;
+    double bytes_per_op;
+};
+
+Measurement measure(const std::function<void()>& fn, double min_time_ms) {
+    // Warm up (fills the operator cache and tensor pools), then repeat at least 3 times and until the minimum time has passed
+    fn();
+
+    std::size_t allocations = s_allocations.load(std::memory_order_relaxed);
+    std::size_t bytes = s_bytes_allocated.load(std::memory_order_relaxed);
+    Timing timing = timeRepeated(fn, min_time_ms, 3);
+
+    Measurement m;
+    m.ns_per_op = timing.ns_per_op;
+    m.allocations_per_op = static_cast<double>(s_allocations.load(std::memory_order_relaxed) - allocations) / timing.reps;
+    m.bytes_per_op = static_cast<double>(s_bytes_allocated.load(std::memory_order_relaxed) - bytes) / timing.reps;
+    return m;
+}
+
+class Suite {
+    public:
+        Suite(const Options& options)
+            : m_options(options)
+        {}
+
+        void add(const std::string& name, std::size_t dim, bry_int_t degree, bry_int_t items, const std::function<void()>& fn) {
+            if (!m_options.filter.empty() && name.find(m_options.filter) == std::string::npos)
+                return;
+
+            Measurement m = measure(fn, m_options.min_time_ms);
+            Result result{name, dim, degree, m.ns_per_op, m.allocations_per_op, m.bytes_per_op, items * 1.0e9 / m.ns_per_op};
+            std::cout << std::left << std::setw(20) << result.name << std::right << std::setw(4) << result.dim << std::setw(8) << result.degree
+                << std::fixed << std::setprecision(1)
+                << std::setw(16) << result.ns_per_op
+                << std::setw(12) << result.allocations_per_op
+                << std::setw(16) << result.bytes_per_op
+                << std::setprecision(2) << std::setw(16) << result.throughput * 1.0e-6 << std::endl;
+            m_results.push_back(result);
+        }
+
+        const std::vector<Result>& results() const {
+            return m_results;
+        }
+
+    private:
+        const Options& m_options;
+        std::vector<Result> m_results;
+};
+
+/// @brief Write one benchmark per line so that the file can be read back by `readJson`
+void writeJson(const std::vector<Result>& results, const std::string& filename) {
+    std::ofstream file(filename);
+    file << std::setprecision(10);
+    file << "{\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        file << "    {\"name\": \"" << r.name << "\", \"dim\": " << r.dim << ", \"degree\": " << r.degree
+            << ", \"ns_per_op\": " << r.ns_per_op << ", \"allocations_per_op\": " << r.allocations_per_op
+            << ", \"bytes_per_op\": " << r.bytes_per_op << ", \"throughput\": " << r.throughput << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+}
+
+std::string jsonField(const std::string& line, const std::string& field) {
+    std::string pattern = "\"" + field + "\": ";
+    std::size_t start = line.find(pattern);
+    if (start == std::string::npos)
+        return "";
+    start += pattern.size();
+    if (line[start] == '"')
+        return line.substr(start + 1, line.find('"', start + 1) - start - 1);
+    return line.substr(start, line.find_first_of(",}", start) - start);
+}
+
+/// @brief Read the ns/op of every benchmark in a file written by `writeJson`
+std::map<std::string, double> readJson(const std::string& filename) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(filename);
+    if (!file) {
+        std::cerr << "Could not open baseline file: " << filename << std::endl;
+        std::exit(2);
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::string name = jsonField(line, "name");
+        if (name.empty())
+            continue;
+        std::string key = name + "/" + jsonField(line, "dim") + "/" + jsonField(line, "degree");
+        baseline[key] = std::stod(jsonField(line, "ns_per_op"));
+    }
+    return baseline;
+}
+
+/// @brief Print the change of every benchmark relative to the baseline
+/// @return Number of regressions
+std::size_t compare(const std::vector<Result>& results, const std::map<std::string, double>& baseline, double threshold) {
+    std::size_t regressions = 0;
+    std::cout << std::endl << "Comparison against baseline (threshold " << threshold << "%)" << std::endl;
+    for (const Result& result : results) {
+        auto it = baseline.find(result.key());
+        if (it == baseline.end()) {
+            std::cout << std::left << std::setw(32) << result.key() << std::right << "  (not in baseline)" << std::endl;
+            continue;
+        }
+
+        double change = 100.0 * (result.ns_per_op - it->second) / it->second;
+        bool regression = change > threshold;
+        regressions += regression;
+        std::cout << std::left << std::setw(32) << result.key() << std::right << std::fixed << std::setprecision(1)
+            << std::setw(16) << it->second << std::setw(16) << result.ns_per_op
+            << std::showpos << std::setw(10) << change << "%" << std::noshowpos
+            << (regression ? "  REGRESSION" : "") << std::endl;
+    }
+    return regressions;
+}
+
+template <std::size_t DIM>
+Polynomial<DIM> randomPolynomial(bry_int_t degree) {
+    Eigen::Tensor<bry_float_t, DIM> tensor(makeUniformArray<bry_int_t, DIM>(degree + 1));
+    tensor.setRandom();
+    return Polynomial<DIM>(std::move(tensor));
+}
+
+template <std::size_t DIM>
+void run(Suite& suite, const std::vector<bry_int_t>& degrees) {
+    // The results are written to a volatile sink so that the operations are not optimized away
+    volatile bry_float_t sink = 0.0;
+    for (bry_int_t degree : degrees) {
+        Polynomial<DIM> p = randomPolynomial<DIM>(degree);
+        Polynomial<DIM> q = randomPolynomial<DIM>(degree);
+        bry_int_t n_coeffs = p.nMonomials();
+
+        if (pow(2 * degree + 1, DIM) <= max_coefficients) {
+            suite.add("multiply", DIM, degree, n_coeffs, [&] {
+                Polynomial<DIM> r = p * q;
+                sink = r.tensor().data()[0];
+            });
+        }
+
+        if (pow(3 * degree + 1, DIM) <= max_coefficients) {
+            suite.add("power", DIM, degree, n_coeffs, [&] {
+                Polynomial<DIM> r = p ^ 3;
+                sink = r.tensor().data()[0];
+            });
+        }
+
+        std::array<bry_float_t, DIM> x = makeUniformArray<bry_float_t, DIM>(0.3);
+        suite.add("evaluate", DIM, degree, n_coeffs, [&] {
+            sink = p(x);
+        });
+
+        suite.add("derivative", DIM, degree, n_coeffs, [&] {
+            Polynomial<DIM> r = p.derivative(DIM - 1);
+            sink = r.tensor().data()[0];
+        });
+
+        if (n_coeffs <= max_dense_coefficients) {
+            suite.add("pwrToBernMatrix", DIM, degree, n_coeffs * n_coeffs, [&] {
+                Matrix matrix = BernsteinBasisTransform<DIM>::pwrToBernMatrix(degree);
+                sink = matrix(0, 0);
+            });
+
+            Matrix matrix = BernsteinBasisTransform<DIM>::pwrToBernMatrix(degree);
+            suite.add("transform", DIM, degree, n_coeffs, [&] {
+                Polynomial<DIM, Basis::Bernstein> r = transform<DIM, Basis::Power, Basis::Bernstein>(p, matrix);
+                sink = r.tensor().data()[0];
+            });
+        }
+
+        KroneckerTransform<DIM> kronecker = BernsteinBasisTransform<DIM>::pwrToBernTransform(degree);
+        suite.add("transformKronecker", DIM, degree, n_coeffs, [&] {
+            Polynomial<DIM, Basis::Bernstein> r = transform<DIM, Basis::Power, Basis::Bernstein>(p, kronecker);
+            sink = r.tensor().data()[0];
+        });
+
+        Polynomial<DIM, Basis::Bernstein> p_bern = transform<DIM, Basis::Power, Basis::Bernstein>(p, kronecker);
+        suite.add("infBound", DIM, degree, n_coeffs, [&] {
+            sink = BernsteinBasisTransform<DIM>::infBound(p_bern).first;
+        });
+
+        BoundWorkspace workspace;
+        suite.add("bound", DIM, degree, n_coeffs, [&] {
+            sink = BernsteinBasisTransform<DIM>::bound(p, workspace).lower_bound;
+        });
+
+        std::array<bry_float_t, DIM> lower = makeUniformArray<bry_float_t, DIM>(-0.5);
+        std::array<bry_float_t, DIM> upper = makeUniformArray<bry_float_t, DIM>(0.25);
+        suite.add("reparameterize", DIM, degree, n_coeffs, [&] {
+            Polynomial<DIM> r = p.reparameterize(lower, makeUniformArray<bry_float_t, DIM>(0.75));
+            sink = r.tensor().data()[0];
+        });
+
+        suite.add("infBoundBox", DIM, degree, n_coeffs, [&] {
+            sink = BernsteinBasisTransform<DIM>::infBound(p, lower, upper, workspace).first;
+        });
+    }
+}
+
+void printUsage(std::ostream& os) {
+    os << "Usage: berry_bench [--filter <substring>] [--min-time <ms>] [--json <file>] [--baseline <file>] [--threshold <percent>]\n"
+        << "  --filter <substring>   Only run the benchmarks whose name contains the substring\n"
+        << "  --min-time <ms>        Minimum time spent on each benchmark (default 100)\n"
+        << "  --json <file>          Write the results as JSON\n"
+        << "  --baseline <file>      Compare the results against a JSON file written by an earlier run\n"
+        << "  --threshold <percent>  Slowdown reported as a regression (default 10), the exit code is 1 if any benchmark regressed\n";
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage(std::cout);
+            std::exit(0);
+        }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for argument: " << arg << std::endl;
+            printUsage(std::cerr);
+            std::exit(2);
+        }
+
+        if (arg == "--filter") {
+            options.filter = argv[++i];
+        } else if (arg == "--min-time") {
+            options.min_time_ms = std::stod(argv[++i]);
+        } else if (arg == "--json") {
+            options.json_file = argv[++i];
+        } else if (arg == "--baseline") {
+            options.baseline_file = argv[++i];
+        } else if (arg == "--threshold") {
+            options.threshold = std::stod(argv[++i]);
+        } else {
+            std::cerr << "Unrecognized argument: " << arg << std::endl;
+            printUsage(std::cerr);
+            std::exit(2);
+        }
+    }
+
+    // Fail before running the suite rather than after
+    if (!options.baseline_file.empty() && !std::ifstream(options.baseline_file)) {
+        std::cerr << "Could not open baseline file: " << options.baseline_file << std::endl;
+        std::exit(2);
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+
+    Suite suite(options);
+    std::cout << "name                 DIM  degree           ns/op   allocs/op      bytes/op   Mcoeffs/s" << std::endl;
+    run<1>(suite, {4, 16, 64, 256});
+    run<2>(suite, {4, 8, 16, 32});
+    run<3>(suite, {2, 4, 8, 16});
+    run<4>(suite, {2, 4, 6, 8});
+    run<5>(suite, {2, 3, 4});
+    run<6>(suite, {1, 2, 3});
+
+    if (!options.json_file.empty())
+        writeJson(suite.results(), options.json_file);
+
+    if (!options.baseline_file.empty()) {
+        std::size_t regressions = compare(suite.results(), readJson(options.baseline_file), options.threshold);
+        if (regressions > 0) {
+            std::cout << regressions << " benchmark(s) regressed" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
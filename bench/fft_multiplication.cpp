@@ -0,0 +1,61 @@
+#include "berry/Polynomial.h"
+#include "berry/Operations.h"
+
+#include "Timing.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace BRY;
+
+/* Previous multiplication: complex FFT of both factors at the exact product size */
+template <std::size_t DIM>
+Eigen::Tensor<bry_float_t, DIM> complexFFTMultiply(const Polynomial<DIM>& p_1, const Polynomial<DIM>& p_2) {
+    bry_int_t desired_size = p_1.degree() + p_2.degree() + 1;
+
+    std::array<std::pair<bry_int_t, bry_int_t>, DIM> paddings_1;
+    std::array<std::pair<bry_int_t, bry_int_t>, DIM> paddings_2;
+    std::array<bry_int_t, DIM> dimensions;
+    for (std::size_t i = 0; i < DIM; ++i) {
+        paddings_1[i] = std::make_pair(0, desired_size - p_1.degree() - 1);
+        paddings_2[i] = std::make_pair(0, desired_size - p_2.degree() - 1);
+        dimensions[i] = i;
+    }
+
+    Eigen::Tensor<bry_float_t, DIM> t_1 = p_1.tensor().pad(paddings_1);
+    Eigen::Tensor<bry_float_t, DIM> t_2 = p_2.tensor().pad(paddings_2);
+    Eigen::Tensor<bry_complex_t, DIM> t_1_fft = t_1.template fft<Eigen::BothParts, Eigen::FFT_FORWARD>(dimensions);
+    Eigen::Tensor<bry_complex_t, DIM> t_2_fft = t_2.template fft<Eigen::BothParts, Eigen::FFT_FORWARD>(dimensions);
+    Eigen::Tensor<bry_complex_t, DIM> product_fft = t_1_fft * t_2_fft;
+    return product_fft.template fft<Eigen::RealPart, Eigen::FFT_REVERSE>(dimensions);
+}
+
+template <std::size_t DIM>
+void run(const std::vector<bry_int_t>& degrees) {
+    for (bry_int_t degree : degrees) {
+        Eigen::Tensor<bry_float_t, DIM> t_1(makeUniformArray<bry_int_t, DIM>(degree + 1));
+        Eigen::Tensor<bry_float_t, DIM> t_2(makeUniformArray<bry_int_t, DIM>(degree + 1));
+        t_1.setRandom();
+        t_2.setRandom();
+        Polynomial<DIM> p_1(t_1);
+        Polynomial<DIM> p_2(t_2);
+
+        double complex_ns = nsPerOp([&] { volatile auto r = complexFFTMultiply(p_1, p_2).data(); (void)r; });
+        double real_ns = nsPerOp([&] { volatile auto r = fftMultiply<DIM>(p_1.tensor(), p_2.tensor()).data(); (void)r; });
+
+        Eigen::Tensor<bry_float_t, 0> err = (complexFFTMultiply(p_1, p_2) - fftMultiply<DIM>(p_1.tensor(), p_2.tensor())).abs().maximum();
+        std::cout << std::setw(4) << DIM << std::setw(8) << degree 
+            << std::setw(16) << std::fixed << std::setprecision(0) << complex_ns 
+            << std::setw(16) << real_ns 
+            << std::setw(10) << std::setprecision(2) << complex_ns / real_ns << "x"
+            << std::setw(12) << std::scientific << std::setprecision(1) << err() << std::endl;
+    }
+}
+
+int main() {
+    std::cout << " DIM  degree   complex (ns)      real (ns)   speedup   max error" << std::endl;
+    run<1>({4, 16, 64, 256});
+    run<2>({4, 8, 16, 32});
+    run<3>({2, 4, 8, 12});
+    run<4>({2, 3, 5, 7});
+}
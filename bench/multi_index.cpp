@@ -0,0 +1,80 @@
+#include "berry/MultiIndex.h"
+#include "berry/Operations.h"
+
+#include "Timing.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace BRY;
+
+template <std::size_t DIM>
+void run(const std::vector<bry_int_t>& constraints) {
+    for (bry_int_t n : constraints) {
+        bry_int_t steps = pow(n, DIM);
+        std::array<bry_int_t, DIM> bounds;
+        std::vector<bry_int_t> bounds_vec(DIM);
+        for (std::size_t d = 0; d < DIM; ++d)
+            bounds_vec[d] = bounds[d] = std::max<bry_int_t>(1, n - d);
+        bry_int_t bounded_steps = 1;
+        for (bry_int_t b : bounds)
+            bounded_steps *= b;
+
+        // The checksums keep the traversals from being optimized away
+        volatile bry_int_t sink = 0;
+        double exhaustive_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (auto midx = mIdx(DIM, n); !midx.last(); ++midx)
+                sum += midx[DIM - 1];
+            sink = sum;
+        });
+        double wrap_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (auto midx = mIdxW(DIM, n); !midx.last(); ++midx)
+                sum += midx.inc().wrappedIdx();
+            sink = sum;
+        });
+        double bounded_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (auto midx = mIdxBEW(bounds_vec, n); !midx.last(); ++midx)
+                sum += midx.inc().wrappedIdx();
+            sink = sum;
+        });
+        double static_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (auto midx = smIdx<DIM>(n); !midx.last(); ++midx)
+                sum += midx.wrappedIdx();
+            sink = sum;
+        });
+        double static_range_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (const auto& midx : smIdxRange<DIM>(n))
+                sum += midx.wrappedIdx();
+            sink = sum;
+        });
+        double static_bounded_ns = nsPerOp([&] {
+            bry_int_t sum = 0;
+            for (auto midx = smIdxB<DIM>(bounds, n); !midx.last(); ++midx)
+                sum += midx.wrappedIdx();
+            sink = sum;
+        });
+
+        std::cout << std::setw(4) << DIM << std::setw(6) << n << std::fixed << std::setprecision(2)
+            << std::setw(12) << exhaustive_ns / steps
+            << std::setw(12) << wrap_ns / steps
+            << std::setw(12) << static_ns / steps
+            << std::setw(12) << static_range_ns / steps
+            << std::setw(12) << bounded_ns / bounded_steps
+            << std::setw(12) << static_bounded_ns / bounded_steps << std::endl;
+    }
+}
+
+int main() {
+    std::cout << "Time per step (ns)" << std::endl;
+    std::cout << " DIM     n     mIdx       mIdxW       smIdx  smIdxRange     mIdxBEW      smIdxB" << std::endl;
+    run<1>({4, 64});
+    run<2>({4, 16, 64});
+    run<3>({4, 8, 16});
+    run<4>({3, 6, 10});
+    run<5>({3, 5, 7});
+}
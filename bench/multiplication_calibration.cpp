@@ -0,0 +1,87 @@
+#include "berry/Polynomial.h"
+#include "berry/Multiplication.h"
+#include "berry/Operations.h"
+
+#include "Timing.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace BRY;
+
+/* Measures the crossover degrees of the multiplication methods on the host machine. The output can be used to
+    tune `Multiplication<DIM>::setThresholds` or to update `Multiplication<DIM>::defaultThresholds`
+*/
+
+/* Largest number of coefficients per factor that is measured */
+constexpr bry_int_t max_coefficients = 20000;
+
+/* Number of consecutive degrees a method must win for a crossover to be accepted */
+constexpr int confirmations = 2;
+
+template <std::size_t DIM>
+double time(bry_int_t degree, MultiplicationMethod method) {
+    Eigen::Tensor<bry_float_t, DIM> a(makeUniformArray<bry_int_t, DIM>(degree + 1));
+    Eigen::Tensor<bry_float_t, DIM> b(makeUniformArray<bry_int_t, DIM>(degree + 1));
+    a.setRandom();
+    b.setRandom();
+    // Repeat at least 3 times and until at least 20 ms has passed
+    return nsPerOp([&] {
+        volatile auto r = Multiplication<DIM>::multiply(a, b, method).data();
+        (void)r;
+    }, 20.0, 3);
+}
+
+template <std::size_t DIM>
+MultiplicationThresholds calibrate() {
+    bry_int_t max_degree = std::min<bry_int_t>(static_cast<bry_int_t>(std::pow(max_coefficients, 1.0 / DIM)) - 1, 128);
+    MultiplicationThresholds result{max_degree + 1, max_degree + 1};
+
+    std::cout << "DIM: " << DIM << " (degrees 1 - " << max_degree << ")" << std::endl;
+    std::cout << "  degree     direct (ns)  karatsuba (ns)        fft (ns)" << std::endl;
+
+    int karatsuba_wins = 0;
+    int fft_wins = 0;
+    for (bry_int_t degree = 1; degree <= max_degree; ++degree) {
+        // One Karatsuba level on top of direct sub-products
+        Multiplication<DIM>::setThresholds({degree, max_degree + 1});
+        double direct_ns = time<DIM>(degree, MultiplicationMethod::Direct);
+        double karatsuba_ns = time<DIM>(degree, MultiplicationMethod::Karatsuba);
+        double fft_ns = time<DIM>(degree, MultiplicationMethod::FFT);
+
+        std::cout << std::setw(8) << degree << std::fixed << std::setprecision(0)
+            << std::setw(16) << direct_ns << std::setw(16) << karatsuba_ns << std::setw(16) << fft_ns << std::endl;
+
+        if (result.karatsuba > max_degree) {
+            karatsuba_wins = karatsuba_ns < direct_ns ? karatsuba_wins + 1 : 0;
+            if (karatsuba_wins == confirmations)
+                result.karatsuba = degree - confirmations + 1;
+        }
+
+        fft_wins = fft_ns < std::min(direct_ns, karatsuba_ns) ? fft_wins + 1 : 0;
+        if (fft_wins == confirmations) {
+            result.fft = degree - confirmations + 1;
+            break;
+        }
+    }
+
+    // Accept a win at the largest measured degree without confirmation
+    if (result.karatsuba > max_degree && karatsuba_wins > 0)
+        result.karatsuba = max_degree - karatsuba_wins + 1;
+    if (result.fft > max_degree && fft_wins > 0)
+        result.fft = max_degree - fft_wins + 1;
+
+    result.karatsuba = std::min(result.karatsuba, result.fft);
+    Multiplication<DIM>::setThresholds(result);
+    std::cout << "  karatsuba: " << result.karatsuba << ", fft: " << result.fft << std::endl << std::endl;
+    return result;
+}
+
+int main() {
+    std::array<MultiplicationThresholds, 6> thresholds{calibrate<1>(), calibrate<2>(), calibrate<3>(), calibrate<4>(), calibrate<5>(), calibrate<6>()};
+
+    std::cout << "Thresholds {karatsuba, fft}:" << std::endl;
+    for (std::size_t i = 0; i < thresholds.size(); ++i)
+        std::cout << "    Multiplication<" << i + 1 << ">::setThresholds({" << thresholds[i].karatsuba << ", " << thresholds[i].fft << "});" << std::endl;
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace BRY {
+
+/// @brief Memory usage counters of an allocator
+struct AllocatorStatistics {
+    /// @brief Number of allocation requests
+    std::size_t allocations = 0;
+
+    /// @brief Total bytes requested (cumulative)
+    std::size_t bytes_allocated = 0;
+
+    /// @brief Bytes currently handed out
+    std::size_t bytes_in_use = 0;
+
+    /// @brief Largest value of `bytes_in_use`
+    std::size_t peak_bytes = 0;
+
+    /// @brief Bytes currently reserved from the system (including cached memory)
+    std::size_t system_bytes = 0;
+};
+
+/// @brief Monotonic (bump) allocator for short-lived scratch memory. Memory is released all at once by rewinding to a marker or
+/// resetting, and the chunks are kept for reuse, so a warmed-up arena does not touch the system allocator. The scratch buffers of
+/// the FFT and Karatsuba products are drawn from the thread arena. Not thread-safe, use `Arena::threadInstance()` for a per-thread
+/// arena
+class Arena {
+    public:
+        /// @brief Position of the arena that can be rewound to
+        struct Marker {
+            std::size_t chunk;
+            std::size_t offset;
+            std::size_t bytes_in_use;
+        };
+
+    public:
+        /// @brief Construct an empty arena
+        /// @param chunk_size Minimum size (bytes) of each chunk reserved from the system
+        BRY_INL Arena(std::size_t chunk_size = BRY_ARENA_CHUNK_SIZE);
+        BRY_INL ~Arena();
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /// @brief Access the arena of the calling thread
+        static BRY_INL Arena& threadInstance();
+
+        /// @brief Allocate raw memory
+        /// @param bytes Number of bytes
+        /// @param alignment Alignment (power of two)
+        /// @return Pointer to the memory (valid until the arena is rewound past it)
+        BRY_INL void* allocate(std::size_t bytes, std::size_t alignment = EIGEN_MAX_ALIGN_BYTES);
+
+        /// @brief Allocate an uninitialized array
+        /// @param n Number of elements
+        template <typename T>
+        T* allocate(std::size_t n);
+
+        /// @brief Allocate a zero-initialized coefficient tensor in the arena
+        /// @param dims Dimensions of the tensor
+        /// @return Tensor map viewing the arena memory
+        template <std::size_t DIM>
+        Eigen::TensorMap<Eigen::Tensor<bry_float_t, DIM>> allocateTensor(const std::array<bry_int_t, DIM>& dims);
+
+        /// @brief Get the current position
+        BRY_INL Marker mark() const;
+
+        /// @brief Release all memory allocated after a marker
+        /// @param marker Position obtained from `mark()`
+        BRY_INL void rewind(const Marker& marker);
+
+        /// @brief Release all memory (chunks are kept)
+        BRY_INL void reset();
+
+        /// @brief Return the cached chunks to the system (the arena must be empty)
+        BRY_INL void shrink();
+
+        /// @brief Get a snapshot of the usage counters
+        BRY_INL AllocatorStatistics statistics() const;
+
+    private:
+        struct Chunk {
+            std::byte* data;
+            std::size_t size;
+        };
+
+    private:
+        std::vector<Chunk> m_chunks;
+        std::size_t m_chunk_size;
+
+        /// @brief Current chunk and offset into the current chunk
+        std::size_t m_chunk = 0;
+        std::size_t m_offset = 0;
+
+        AllocatorStatistics m_stats;
+};
+
+/// @brief Rewinds an arena to its position at construction when going out of scope. Usage:
+/// { ScopedArena scope; double* tmp = scope.arena().allocate<double>(n); ... }
+class ScopedArena {
+    public:
+        /// @brief Scope the arena of the calling thread
+        BRY_INL ScopedArena();
+
+        /// @brief Scope a given arena
+        /// @param arena Arena to rewind on destruction
+        BRY_INL ScopedArena(Arena& arena);
+
+        BRY_INL ~ScopedArena();
+
+        ScopedArena(const ScopedArena&) = delete;
+        ScopedArena& operator=(const ScopedArena&) = delete;
+
+        /// @brief Access the scoped arena
+        BRY_INL Arena& arena();
+
+    private:
+        Arena& m_arena;
+        Arena::Marker m_marker;
+};
+
+/// @brief Recycles the storage of coefficient tensors by number of coefficients, so that tensors of a repeated size do not touch
+/// the system allocator. Used for the storage of `Polynomial` when `BRY_ENABLE_TENSOR_POOL` is defined. Not thread-safe, use
+/// `TensorPool::threadInstance()` for a per-thread pool
+template <std::size_t DIM>
+class TensorPool {
+    public:
+        /// @brief Reuse and memory usage counters
+        struct Statistics {
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+
+            /// @brief Total bytes allocated from the system on misses (cumulative)
+            std::size_t bytes_allocated = 0;
+
+            /// @brief Number of cached tensors
+            std::size_t cached = 0;
+
+            /// @brief Total size of the cached tensors (bytes)
+            std::size_t cached_bytes = 0;
+
+            /// @brief Largest value of `cached_bytes`
+            std::size_t peak_cached_bytes = 0;
+        };
+
+    public:
+        TensorPool() = default;
+        ~TensorPool();
+
+        TensorPool(const TensorPool&) = delete;
+        TensorPool& operator=(const TensorPool&) = delete;
+
+        /// @brief Access the pool of the calling thread (`nullptr` once the thread is shutting down)
+        static TensorPool* threadInstance();
+
+        /// @brief Get an (uninitialized) tensor, reusing cached storage of the same number of coefficients if possible
+        /// @param dims Dimensions of the tensor
+        Eigen::Tensor<bry_float_t, DIM> acquire(const std::array<bry_int_t, DIM>& dims);
+
+        /// @brief Cache the storage of a tensor that is no longer needed. The storage is released instead if there are already
+        /// `BRY_TENSOR_POOL_MAX_PER_SIZE` cached tensors of the same size, or if caching it would exceed `BRY_TENSOR_POOL_MAX_BYTES`
+        /// @param tensor Tensor (left empty)
+        void recycle(Eigen::Tensor<bry_float_t, DIM>&& tensor);
+
+        /// @brief Return the cached tensors to the system
+        void clear();
+
+        /// @brief Get a snapshot of the reuse counters
+        Statistics statistics() const;
+
+    private:
+        static bool& alive();
+
+    private:
+        std::unordered_map<bry_int_t, std::vector<Eigen::Tensor<bry_float_t, DIM>>> m_free;
+        Statistics m_stats;
+};
+
+}
+
+#include "impl/Allocator_impl.hpp"
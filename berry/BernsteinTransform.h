@@ -2,12 +2,62 @@
 
 #include "Options.h"
 #include "Types.h"
+#include "Instrumentation.h"
 #include "Polynomial.h"
+#include "KroneckerTransform.h"
+#include "OperatorCache.h"
 
 #include <array>
+#include <memory>
+#include <vector>
 
 namespace BRY {
 
+/// @brief Result of the fused power basis to Bernstein basis bound
+template <std::size_t DIM>
+struct BernsteinBound {
+    /// @brief Lower bound (smallest Bernstein coefficient)
+    bry_float_t lower_bound;
+
+    /// @brief Index of the smallest Bernstein coefficient
+    std::array<bry_int_t, DIM> coefficient_idx;
+
+    /// @brief Flag if the vertex condition is met (true lower bound achieved)
+    bool vertex_condition;
+
+    /// @brief Gap between the inf lower and upper bound (zero if the vertex condition is met)
+    bry_float_t gap;
+};
+
+/// @brief Reusable scratch memory for `BernsteinBasisTransform::bound`. The buffers only grow, so repeated bounds of the same 
+/// size do not allocate. A workspace must not be shared between threads
+class BoundWorkspace {
+    public:
+        BoundWorkspace() = default;
+
+        /// @brief Number of coefficients that fit in the scratch buffers without reallocating
+        BRY_INL std::size_t capacity() const;
+
+    private:
+        template <std::size_t>
+        friend class BernsteinBasisTransform;
+
+        /// @brief Grow the scratch buffers to hold at least `size` coefficients
+        BRY_INL void reserve(std::size_t size);
+
+    private:
+        std::vector<bry_float_t> m_buffer_a;
+        std::vector<bry_float_t> m_buffer_b;
+
+        /// @brief 1-D transformation of the last bound (reused while the degrees do not change)
+        std::shared_ptr<const Matrix> m_factor;
+
+        /// @brief Coefficients of the last polynomial reparameterized onto the unit box (bounds on a box)
+        std::vector<bry_float_t> m_reparameterized;
+        bry_int_t m_degree = -1;
+        bry_int_t m_degree_increase = -1;
+};
+
 template <std::size_t DIM>
 class BernsteinBasisTransform {
     public:
@@ -22,6 +72,61 @@ class BernsteinBasisTransform {
         /// @return Transformation matrix
         static Matrix bernToPwrMatrix(bry_int_t degree);
 
+        /// @brief Sparse version of `pwrToBernMatrix` (only terms with every exponent less than or equal to the row exponents are nonzero)
+        /// @param degree Degree of the power basis polynomial
+        /// @param degree_increase Elevate the degree of the transformation
+        /// @return Sparse transformation matrix of elevated degree (`degree + degree_increase`)
+        static SparseMatrix pwrToBernSparseMatrix(bry_int_t degree, bry_int_t degree_increase = 0);
+
+        /// @brief Sparse version of `bernToPwrMatrix`
+        /// @param degree Degree of the Bernstein basis polynomial
+        /// @return Sparse transformation matrix
+        static SparseMatrix bernToPwrSparseMatrix(bry_int_t degree);
+
+        /// @brief Compute the transformation for power basis to Bernstein basis as a product of 1-D transformations
+        /// @param degree Degree of the power basis polynomial
+        /// @param degree_increase Elevate the degree of the transformation
+        /// @return Kronecker transformation of elevated degree (`degree + degree_increase`)
+        static KroneckerTransform<DIM> pwrToBernTransform(bry_int_t degree, bry_int_t degree_increase = 0);
+
+        /// @brief Compute the inverse transformation for Bernstein basis to power basis as a product of 1-D transformations
+        /// @param degree Degree of the Bernstein basis polynomial
+        /// @return Kronecker transformation
+        static KroneckerTransform<DIM> bernToPwrTransform(bry_int_t degree);
+
+        /// @brief Cached version of `pwrToBernMatrix` shared through the process-wide operator cache
+        /// @param degree Degree of the power basis polynomial
+        /// @param degree_increase Elevate the degree of the transformation
+        /// @return Shared immutable transformation matrix
+        static std::shared_ptr<const Matrix> cachedPwrToBernMatrix(bry_int_t degree, bry_int_t degree_increase = 0);
+
+        /// @brief Cached version of `bernToPwrMatrix` shared through the process-wide operator cache
+        /// @param degree Degree of the Bernstein basis polynomial
+        /// @return Shared immutable transformation matrix
+        static std::shared_ptr<const Matrix> cachedBernToPwrMatrix(bry_int_t degree);
+
+        /// @brief Cached version of `pwrToBernSparseMatrix` shared through the process-wide operator cache
+        /// @param degree Degree of the power basis polynomial
+        /// @param degree_increase Elevate the degree of the transformation
+        /// @return Shared immutable sparse transformation matrix
+        static std::shared_ptr<const SparseMatrix> cachedPwrToBernSparseMatrix(bry_int_t degree, bry_int_t degree_increase = 0);
+
+        /// @brief Cached version of `bernToPwrSparseMatrix` shared through the process-wide operator cache
+        /// @param degree Degree of the Bernstein basis polynomial
+        /// @return Shared immutable sparse transformation matrix
+        static std::shared_ptr<const SparseMatrix> cachedBernToPwrSparseMatrix(bry_int_t degree);
+
+        /// @brief Cached version of `pwrToBernTransform` shared through the process-wide operator cache
+        /// @param degree Degree of the power basis polynomial
+        /// @param degree_increase Elevate the degree of the transformation
+        /// @return Shared immutable Kronecker transformation
+        static std::shared_ptr<const KroneckerTransform<DIM>> cachedPwrToBernTransform(bry_int_t degree, bry_int_t degree_increase = 0);
+
+        /// @brief Cached version of `bernToPwrTransform` shared through the process-wide operator cache
+        /// @param degree Degree of the Bernstein basis polynomial
+        /// @return Shared immutable Kronecker transformation
+        static std::shared_ptr<const KroneckerTransform<DIM>> cachedBernToPwrTransform(bry_int_t degree);
+
         /// @brief Compute the lower bound of a polynomial on the unit interval in the Bernstein basis
         /// @param p Polynomial in the Bernstein basis
         /// @return Lower bound (smallest coefficient), flag if the vertex condition is met (true lower bound achieved)
@@ -33,18 +138,63 @@ class BernsteinBasisTransform {
         /// @return Lower bound (smallest coefficient), flag if the vertex condition is met (true lower bound achieved)
         static std::pair<bry_float_t, bool> infBound(const BRY::Polynomial<DIM, BRY::Basis::Bernstein>& p, std::array<bry_int_t, DIM>& coefficient_idx);
 
+        /// @brief Compute the lower bound of a power basis polynomial on the box [lower, upper]. The polynomial is reparameterized onto 
+        /// the unit box (Taylor shift and scale of each mode) and then bounded with `bound`
+        /// @param p Polynomial in the power basis
+        /// @param lower Lower corner of the box
+        /// @param upper Upper corner of the box
+        /// @param workspace Scratch memory reused across calls
+        /// @param degree_increase Elevated degree of Bernstein transformation
+        /// @return Lower bound (smallest coefficient), flag if the vertex condition is met (true lower bound achieved)
+        static std::pair<bry_float_t, bool> infBound(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const std::array<bry_float_t, DIM>& lower, 
+            const std::array<bry_float_t, DIM>& upper, BoundWorkspace& workspace, bry_int_t degree_increase = 0);
+
         /// @brief Compute the difference between an upper and lower bound on the infemum of a polynomial
         /// @param p Polynomial in the power basis
         /// @param degree_increase Elevated degree of Bernstein transformation
         /// @return Gap between inf lower and upper bound
         static bry_float_t infBoundGap(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, bool vertex_condition = false, bry_int_t degree_increase = 0);
 
+        /// @brief Compute the bound of a power basis polynomial on the unit box without materializing the Bernstein polynomial. The
+        /// transformation is applied mode-by-mode in the workspace buffers, and the min, argmin and vertex condition are reduced 
+        /// while the last mode is applied. Equivalent to `infBound` of the transformed polynomial followed by `infBoundGap`
+        /// @param p Polynomial in the power basis
+        /// @param workspace Scratch memory reused across calls
+        /// @param degree_increase Elevated degree of Bernstein transformation
+        /// @return Bound
+        static BernsteinBound<DIM> bound(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, BoundWorkspace& workspace, bry_int_t degree_increase = 0);
+
         static Eigen::Vector<bry_float_t, DIM> ctrlPtOnUnitBox(const std::array<bry_int_t, DIM>& coefficient_idx, bry_int_t bernstein_p_deg);
 
+        /// @brief Split a polynomial in the Bernstein basis along one dimension using de Casteljau subdivision
+        /// @param p Polynomial in the Bernstein basis
+        /// @param dim Dimension to split along
+        /// @param t Split point in [0, 1]
+        /// @return Bernstein basis polynomials on the lower (`x_dim` in [0, t]) and upper (`x_dim` in [t, 1]) parts of the unit box, 
+        /// each reparameterized back onto the unit box
+        static std::pair<BRY::Polynomial<DIM, BRY::Basis::Bernstein>, BRY::Polynomial<DIM, BRY::Basis::Bernstein>> subdivide(const BRY::Polynomial<DIM, BRY::Basis::Bernstein>& p, std::size_t dim, bry_float_t t = 0.5);
+
     private:
+        /// @brief Visit every (possibly) nonzero entry of a transformation matrix (column exponents bounded by the row exponents)
+        template <typename COEFF_LAM, typename VISITOR>
+        static void forEachBigMatrixEntry(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff, VISITOR visit);
+
         template <typename COEFF_LAM>
         static Matrix makeBigMatrix(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff);
 
+        template <typename COEFF_LAM>
+        static SparseMatrix makeBigSparseMatrix(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff);
+
+        /// @brief `infBoundGap` of a (column-major) power basis coefficient tensor
+        static bry_float_t infBoundGap(const bry_float_t* coeffs, bry_int_t degree, bool vertex_condition, bry_int_t degree_increase);
+
+        /// @brief `bound` of a (column-major) power basis coefficient tensor
+        static BernsteinBound<DIM> bound(const bry_float_t* coeffs, bry_int_t degree, BoundWorkspace& workspace, bry_int_t degree_increase);
+
+        /// @brief Transformation coefficient lambdas shared by the dense and sparse matrices
+        static BRY_INL auto pwrToBernCoeff(bry_int_t to_degree);
+        static BRY_INL auto bernToPwrCoeff(bry_int_t degree);
+
     private:
         bry_float_t m_min_coeff;
 };
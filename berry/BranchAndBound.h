@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Polynomial.h"
+#include "BernsteinTransform.h"
+#include "TaskScheduler.h"
+
+#include <array>
+#include <vector>
+
+namespace BRY {
+
+/// @brief Global minimizer of a polynomial on the unit box [0, 1]^DIM. The box is recursively split using de Casteljau subdivision,
+/// where the smallest Bernstein coefficient of each sub-box is a lower bound, and evaluations at control points provide upper bounds
+template <std::size_t DIM>
+class BranchAndBoundMinimizer {
+    public:
+        /// @brief Per-run search statistics
+        struct Statistics {
+            /// @brief Number of boxes that were bounded
+            std::size_t visited = 0;
+
+            /// @brief Number of boxes that were split
+            std::size_t subdivided = 0;
+
+            /// @brief Number of boxes discarded because their lower bound exceeds the best upper bound
+            std::size_t pruned = 0;
+
+            /// @brief Number of boxes discarded because the vertex condition was met (exact minimum on the box)
+            std::size_t resolved = 0;
+
+            /// @brief Deepest subdivision level
+            std::size_t max_depth = 0;
+
+            /// @brief Largest number of boxes waiting in the queue
+            std::size_t max_queue_size = 0;
+        };
+
+        /// @brief Result of the minimization
+        struct Result {
+            /// @brief Guaranteed lower bound of the minimum on the unit box
+            bry_float_t lower_bound;
+
+            /// @brief Smallest value found (upper bound of the minimum)
+            bry_float_t upper_bound;
+
+            /// @brief Point in the unit box where `upper_bound` is achieved
+            Eigen::Vector<bry_float_t, DIM> minimizer;
+
+            /// @brief True if `upper_bound - lower_bound` is within the tolerance
+            bool converged;
+
+            Statistics statistics;
+        };
+
+    public:
+        /// @brief Construct the minimizer
+        /// @param tolerance Terminate when the gap between the upper and lower bound of the minimum is within the tolerance
+        /// @param max_boxes Maximum number of boxes to bound before terminating
+        /// @param batch_size Number of boxes taken from the queue and split together in each iteration
+        /// @param scheduler If provided, the boxes in a batch are split and bounded in parallel. The result only depends on `batch_size`, 
+        /// not on the number of threads
+        BranchAndBoundMinimizer(bry_float_t tolerance = 1.0e-6, std::size_t max_boxes = 100000, std::size_t batch_size = 1, TaskScheduler* scheduler = nullptr);
+
+        /// @brief Minimize a polynomial on the unit box
+        /// @param p Polynomial in the power basis
+        /// @param degree_increase Elevated degree of the initial Bernstein transformation
+        /// @return Bounds on the minimum and a minimizer
+        Result minimize(const Polynomial<DIM, Basis::Power>& p, bry_int_t degree_increase = 0) const;
+
+        /// @brief Minimize a polynomial on the unit box
+        /// @param p Polynomial in the Bernstein basis
+        /// @return Bounds on the minimum and a minimizer
+        Result minimize(const Polynomial<DIM, Basis::Bernstein>& p) const;
+
+    private:
+        /// @brief Sub-box of the unit box with the Bernstein coefficients of the polynomial on the sub-box
+        struct Box {
+            Polynomial<DIM, Basis::Bernstein> p;
+            std::array<bry_float_t, DIM> lower;
+            std::array<bry_float_t, DIM> width;
+            bry_float_t lower_bound;
+            std::size_t depth;
+        };
+
+        /// @brief Orders the queue such that the box with the smallest lower bound is on top
+        struct BoxCompare {
+            bool operator()(const Box& lhs, const Box& rhs) const { return lhs.lower_bound > rhs.lower_bound; }
+        };
+
+        /// @brief Bounds on a box and the candidate point given by the control point of the smallest coefficient
+        struct BoxBound {
+            bry_float_t lower_bound;
+            bry_float_t candidate_value;
+            Eigen::Vector<bry_float_t, DIM> candidate;
+            bool vertex_condition;
+        };
+
+        /// @brief Boxes and their bounds resulting from splitting a box
+        struct Split {
+            std::array<Box, 2> boxes;
+            std::array<BoxBound, 2> bounds;
+        };
+
+    private:
+        static BoxBound bound(const Box& box);
+
+        static Split split(const Box& box);
+
+    private:
+        bry_float_t m_tolerance;
+        std::size_t m_max_boxes;
+        std::size_t m_batch_size;
+        TaskScheduler* m_scheduler;
+};
+
+}
+
+#include "impl/BranchAndBound_impl.hpp"
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace BRY {
+
+/// @brief Degree change (lift or truncation) of a coefficient tensor as an index map. Every term shared by both degrees is copied
+/// to the same term of the new degree, and the shared terms are contiguous along dimension 0, so the transformation is applied as a
+/// scatter copy of `(min(from, to) + 1)^(DIM - 1)` runs. No operator storage is needed
+template <std::size_t DIM>
+class DegreeChangeTransform {
+    public:
+        /// @brief Construct a degree change
+        /// @param from_deg Degree of the input polynomial
+        /// @param to_deg Degree of the output polynomial
+        DegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg);
+
+        /// @brief Degree of the input polynomial
+        BRY_INL bry_int_t fromDegree() const;
+
+        /// @brief Degree of the output polynomial
+        BRY_INL bry_int_t toDegree() const;
+
+        /// @brief Apply the degree change to a coefficient tensor
+        /// @param tensor Tensor with every dimension of size `fromDegree() + 1`
+        /// @return Tensor with every dimension of size `toDegree() + 1`
+        Eigen::Tensor<bry_float_t, DIM> apply(const Eigen::Tensor<bry_float_t, DIM>& tensor) const;
+
+    private:
+        bry_int_t m_from_deg;
+        bry_int_t m_to_deg;
+};
+
+}
+
+#include "impl/DegreeChangeTransform_impl.hpp"
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Instrumentation.h"
+#include "Allocator.h"
+
+#include <array>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+#include <unsupported/Eigen/FFT>
+
+namespace BRY {
+
+/// @brief Smallest FFT-friendly size (product of 2, 3 and 5) that is at least `n`
+/// @param n Minimum size
+/// @param multiple_of_4 Require the size to be a multiple of 4 (fast path of the real-input FFT)
+/// @return FFT size
+static BRY_INL bry_int_t fftFriendlySize(bry_int_t n, bool multiple_of_4 = false);
+
+/// @brief Multi-dimensional real-input FFT for a fixed tensor shape. Dimension 0 is transformed with a real-to-complex FFT that only
+/// keeps the non-redundant half of the spectrum, and the remaining dimensions are transformed with complex FFTs. The 1-D plans and
+/// scratch buffers are reused across calls
+template <std::size_t DIM>
+class RealFFT {
+    public:
+        /// @brief Construct the plan
+        /// @param shape Shape of the real tensor
+        RealFFT(const std::array<bry_int_t, DIM>& shape);
+
+        /// @brief Shape of the real tensor
+        BRY_INL const std::array<bry_int_t, DIM>& shape() const;
+
+        /// @brief Shape of the (half) spectrum tensor
+        BRY_INL const std::array<bry_int_t, DIM>& spectrumShape() const;
+
+        /// @brief Forward transform
+        /// @param real Real tensor data of size `shape()`
+        /// @param spectrum Spectrum tensor data of size `spectrumShape()`
+        void forward(const bry_float_t* real, bry_complex_t* spectrum);
+
+        /// @brief Normalized inverse transform
+        /// @param spectrum Spectrum tensor data of size `spectrumShape()` (overwritten)
+        /// @param real Real tensor data of size `shape()`
+        void inverse(bry_complex_t* spectrum, bry_float_t* real);
+
+        /// @brief Get the plan for a given shape. Plans are cached per thread and reused across calls, keeping at most 
+        /// `BRY_FFT_PLAN_CACHE_SIZE` of the most recently used plans
+        /// @param shape Shape of the real tensor
+        /// @return Plan (valid until the next call to `plan` or `clearPlans` on the same thread)
+        static RealFFT& plan(const std::array<bry_int_t, DIM>& shape);
+
+        /// @brief Release every plan cached by the calling thread
+        static void clearPlans();
+
+    private:
+        /// @brief Per-thread plans, most recently used first
+        struct PlanCache {
+            std::list<std::unique_ptr<RealFFT>> lru;
+            std::map<std::array<bry_int_t, DIM>, typename std::list<std::unique_ptr<RealFFT>>::iterator> plans;
+        };
+
+        static PlanCache& planCache();
+
+        /// @brief Complex FFT along every dimension except dimension 0
+        void complexPass(bry_complex_t* spectrum, bool inverse);
+
+    private:
+        std::array<bry_int_t, DIM> m_shape;
+        std::array<bry_int_t, DIM> m_spectrum_shape;
+        Eigen::FFT<bry_float_t> m_fft;
+        std::vector<bry_complex_t> m_fiber_in;
+        std::vector<bry_complex_t> m_fiber_out;
+};
+
+/// @brief Multiply two coefficient tensors (linear convolution) using real-input FFTs padded to FFT-friendly sizes
+/// @param a Coefficient tensor
+/// @param b Coefficient tensor
+/// @return Product coefficient tensor with dimension `d` of size `a.dimension(d) + b.dimension(d) - 1`
+template <std::size_t DIM>
+static Eigen::Tensor<bry_float_t, DIM> fftMultiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+/// @brief Raise a coefficient tensor to a power using one padded real-input FFT and integer power by squaring of each
+/// spectrum coefficient
+/// @param a Coefficient tensor
+/// @param exp Exponent (must be positive)
+/// @return Power coefficient tensor with dimension `d` of size `exp * (a.dimension(d) - 1) + 1`
+template <std::size_t DIM>
+static Eigen::Tensor<bry_float_t, DIM> fftPower(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp);
+
+/// @brief Compute every power of a coefficient tensor up to a maximum exponent from one padded spectrum
+/// @param a Coefficient tensor
+/// @param max_exp Maximum exponent
+/// @return Coefficient tensors of `a^0, a^1, ..., a^max_exp`
+template <std::size_t DIM>
+static std::vector<Eigen::Tensor<bry_float_t, DIM>> fftPowers(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t max_exp);
+
+}
+
+#include "impl/FFT_impl.hpp"
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Polynomial.h"
+
+#include <array>
+#include <utility>
+
+/* Forward Declarations */
+namespace BRY {
+
+template <std::size_t DIM, std::size_t DEG>
+class FixedPolynomial;
+
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator+(const BRY::FixedPolynomial<DIM, DEG>& p_1, const BRY::FixedPolynomial<DIM, DEG>& p_2);
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator-(const BRY::FixedPolynomial<DIM, DEG>& p);
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator-(const BRY::FixedPolynomial<DIM, DEG>& p_1, const BRY::FixedPolynomial<DIM, DEG>& p_2);
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator*(BRY::bry_float_t scalar, const BRY::FixedPolynomial<DIM, DEG>& p);
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator*(const BRY::FixedPolynomial<DIM, DEG>& p, BRY::bry_float_t scalar);
+
+template <std::size_t DIM, std::size_t DEG_1, std::size_t DEG_2>
+constexpr BRY::FixedPolynomial<DIM, DEG_1 + DEG_2> operator*(const BRY::FixedPolynomial<DIM, DEG_1>& p_1, const BRY::FixedPolynomial<DIM, DEG_2>& p_2);
+
+namespace BRY {
+
+/// @brief Power basis polynomial with a compile-time degree. Coefficients are stored inline (`std::array`) in the same order as the
+/// coefficient tensor of `Polynomial`, so small polynomials live on the stack, and evaluation is a fully unrolled nested Horner's method
+template <std::size_t DIM, std::size_t DEG>
+class FixedPolynomial {
+    public:
+        /// @brief Number of coefficients `(DEG + 1)^DIM`
+        static constexpr std::size_t s_size = [] {
+            std::size_t sz = 1;
+            for (std::size_t d = 0; d < DIM; ++d)
+                sz *= DEG + 1;
+            return sz;
+        }();
+
+    public:
+        /// @brief Construct the zero polynomial
+        constexpr FixedPolynomial();
+
+        /// @brief Construct polynomial given the (flattened) coefficients
+        /// @param coefficients Coefficients ordered like the coefficient tensor of `Polynomial`
+        constexpr FixedPolynomial(const std::array<bry_float_t, s_size>& coefficients);
+
+        /// @brief Construct from a dense power basis polynomial
+        /// @param p Polynomial (degree must not exceed `DEG`)
+        explicit FixedPolynomial(const Polynomial<DIM, Basis::Power>& p);
+
+        /// @brief Get the degree
+        static constexpr bry_int_t degree();
+
+        /// @brief Access a specific coefficient of a term. Usage: coeff(1, 0, 3) returns the coefficient of the term (x0)(x2^3)
+        /// @param ...exponents Exponents in order of variables
+        /// @return Reference to mutable value
+        template <typename ... DEGS>
+        constexpr bry_float_t& coeff(DEGS ... exponents);
+        constexpr bry_float_t& coeff(const std::array<bry_int_t, DIM>& exponents);
+
+        /// @brief Access a specific coefficient of a term. Usage: coeff(1, 0, 3) returns the coefficient of the term (x0)(x2^3)
+        /// @param ...exponents Exponents in order of variables
+        /// @return Imutable value
+        template <typename ... DEGS>
+        constexpr bry_float_t coeff(DEGS ... exponents) const;
+        constexpr bry_float_t coeff(const std::array<bry_int_t, DIM>& exponents) const;
+
+        /// @brief Evaluate the polynomial for given x vector
+        /// @param ...x `x` values
+        /// @return Scalar
+        template <typename ... FLTS>
+        constexpr bry_float_t operator()(FLTS ... x) const;
+        constexpr bry_float_t operator()(const std::array<bry_float_t, DIM>& x) const;
+
+        /// @brief Compute the (partial) derivative of the polynomial with respect to a given dimension
+        /// @param dx_idx Dimension to take the partial derivative with respect to
+        /// @return Derivative polynomial (with the same degree)
+        constexpr FixedPolynomial derivative(bry_int_t dx_idx) const;
+
+        /// @brief Convert to a dense power basis polynomial of degree `DEG`
+        Polynomial<DIM, Basis::Power> toDense() const;
+
+        /// @brief Access the (flattened) coefficients
+        constexpr const std::array<bry_float_t, s_size>& coefficients() const;
+
+        /// @brief Stride of dimension `d` in the flattened coefficients, `(DEG + 1)^d`
+        static constexpr std::size_t stride(std::size_t d);
+
+    private:
+        /// @brief Nested Horner's method for the sub-polynomial in dimensions `0, ..., D` starting at `coeffs`
+        template <std::size_t D>
+        static constexpr bry_float_t horner(const bry_float_t* coeffs, const std::array<bry_float_t, DIM>& x);
+
+        template <std::size_t D, std::size_t ... K>
+        static constexpr bry_float_t hornerUnrolled(const bry_float_t* coeffs, const std::array<bry_float_t, DIM>& x, std::index_sequence<K ...>);
+
+    private:
+        std::array<bry_float_t, s_size> m_coeffs;
+};
+
+}
+
+#include "impl/FixedPolynomial_impl.hpp"
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace BRY {
+
+/// @brief Instrumented operations
+enum class Operation {
+    Add,
+    Subtract,
+    Negate,
+    Scale,
+    Multiply,
+    Power,
+    Powers,
+    DirectMultiply,
+    KaratsubaMultiply,
+    FFTMultiply,
+    FFTPower,
+    FFTPowers,
+    Evaluate,
+    EvaluateBatch,
+    Derivative,
+    LiftDegree,
+    Reparameterize,
+    Transform,
+    PwrToBernMatrix,
+    BernToPwrMatrix,
+    PwrToBernSparseMatrix,
+    BernToPwrSparseMatrix,
+    PwrToBernTransform,
+    BernToPwrTransform,
+    DegreeChangeMatrix,
+    SparseDegreeChangeMatrix,
+    InfBound,
+    InfBoundGap,
+    Bound,
+    Subdivide,
+    Count
+};
+
+/// @brief Number of instrumented operations
+inline constexpr std::size_t s_n_operations = static_cast<std::size_t>(Operation::Count);
+
+/// @brief Name of an operation (used as the JSON key)
+BRY_INL const char* operationName(Operation operation);
+
+/// @brief Accumulated counters of one operation
+struct OperationStatistics {
+    /// @brief Number of calls
+    std::size_t calls = 0;
+
+    /// @brief Cumulative wall time (ns)
+    std::size_t nanoseconds = 0;
+
+    /// @brief Cumulative number of input coefficients (tensor sizes)
+    std::size_t coefficients = 0;
+
+    /// @brief Cumulative size of the results allocated by the operation (bytes)
+    std::size_t bytes_allocated = 0;
+};
+
+/// @brief Counters of every operation summed over all threads at one point in time
+struct InstrumentationSnapshot {
+    std::array<OperationStatistics, s_n_operations> operations{};
+
+    /// @brief Access the counters of an operation
+    BRY_INL const OperationStatistics& operator[](Operation operation) const;
+
+    /// @brief Serialize the counters of every called operation
+    /// @return JSON object keyed by operation name
+    BRY_INL std::string toJson() const;
+};
+
+/// @brief Opt-in per-operation counters. When `BRY_ENABLE_INSTRUMENTATION` is defined, the public operations in Polynomial, FFT,
+/// Multiplication, BernsteinTransform and Operations are timed with `BRY_PROBE`. Each thread accumulates into its own counters
+/// (relaxed atomics written only by the owning thread), and a snapshot sums the counters of every live and exited thread. Without
+/// `BRY_ENABLE_INSTRUMENTATION` the probes compile to nothing and snapshots are empty
+class Instrumentation {
+    public:
+        /// @brief Check if instrumentation is compiled in
+        static constexpr bool enabled();
+
+        /// @brief Sum the counters of every thread
+        static BRY_INL InstrumentationSnapshot snapshot();
+
+        /// @brief Zero the counters of every thread (calls that are running concurrently may be partially lost)
+        static BRY_INL void reset();
+
+        /// @brief Add one call to the counters of the calling thread
+        /// @param operation Operation
+        /// @param nanoseconds Duration of the call
+        /// @param coefficients Number of input coefficients
+        /// @param bytes_allocated Size of the allocated results
+        static BRY_INL void record(Operation operation, std::size_t nanoseconds, std::size_t coefficients, std::size_t bytes_allocated);
+
+    private:
+        struct Counters {
+            std::atomic<std::size_t> calls{0};
+            std::atomic<std::size_t> nanoseconds{0};
+            std::atomic<std::size_t> coefficients{0};
+            std::atomic<std::size_t> bytes_allocated{0};
+        };
+
+        /// @brief Counters of one thread. Registered on construction, and merged into the retired counters on thread exit
+        struct ThreadCounters {
+            BRY_INL ThreadCounters();
+            BRY_INL ~ThreadCounters();
+            std::array<Counters, s_n_operations> operations;
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<ThreadCounters*> threads;
+            std::array<OperationStatistics, s_n_operations> retired{};
+        };
+
+    private:
+        static BRY_INL Registry& registry();
+        static BRY_INL ThreadCounters& threadCounters();
+};
+
+/// @brief Times a scope and records it on destruction. Use through `BRY_PROBE` so that it is compiled out when disabled
+class ScopedProbe {
+    public:
+        /// @brief Start timing an operation
+        /// @param operation Operation
+        /// @param coefficients Number of input coefficients
+        BRY_INL ScopedProbe(Operation operation, std::size_t coefficients);
+        BRY_INL ~ScopedProbe();
+
+        ScopedProbe(const ScopedProbe&) = delete;
+        ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+        /// @brief Set the size of the allocated results
+        BRY_INL void setBytes(std::size_t bytes_allocated);
+
+    private:
+        Operation m_operation;
+        std::size_t m_coefficients;
+        std::size_t m_bytes_allocated = 0;
+        std::chrono::steady_clock::time_point m_start;
+};
+
+}
+
+#ifdef BRY_ENABLE_INSTRUMENTATION
+    #define BRY_PROBE(operation, coefficients) BRY::ScopedProbe _bry_probe(BRY::Operation::operation, coefficients)
+    #define BRY_PROBE_BYTES(bytes_allocated) _bry_probe.setBytes(bytes_allocated)
+#else
+    #define BRY_PROBE(operation, coefficients)
+    #define BRY_PROBE_BYTES(bytes_allocated)
+#endif
+
+#include "impl/Instrumentation_impl.hpp"
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+
+#include <array>
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace BRY {
+
+/// @brief Linear transformation of a coefficient tensor that is the Kronecker (tensor) product of `DIM` 1-D transformations.
+/// Only the 1-D factors are stored, and the transformation is applied mode-by-mode on the coefficient tensor, which costs
+/// O(DIM * n^(DIM + 1)) instead of the O(n^(2 * DIM)) needed for the equivalent dense matrix
+template <std::size_t DIM>
+class KroneckerTransform {
+    public:
+        /// @brief Construct from a set of 1-D factors
+        /// @param factors Factor `d` maps the coefficients along dimension `d` (`rows` x `cols` for the new and old sizes)
+        KroneckerTransform(const std::array<Matrix, DIM>& factors);
+
+        /// @brief Construct moving a set of 1-D factors
+        /// @param factors Factor `d` maps the coefficients along dimension `d` (`rows` x `cols` for the new and old sizes)
+        KroneckerTransform(std::array<Matrix, DIM>&& factors);
+
+        /// @brief Construct a transform that applies the same 1-D factor along every dimension
+        /// @param factor 1-D transformation matrix
+        KroneckerTransform(const Matrix& factor);
+
+        /// @brief Access the 1-D factor along a given dimension
+        /// @param d Dimension
+        BRY_INL const Matrix& factor(std::size_t d) const;
+
+        /// @brief Number of rows of the equivalent dense matrix
+        bry_int_t rows() const;
+
+        /// @brief Number of cols of the equivalent dense matrix
+        bry_int_t cols() const;
+
+        /// @brief Apply the transformation to a coefficient tensor
+        /// @param tensor Tensor with dimension `d` of size `factor(d).cols()`
+        /// @return Transformed tensor with dimension `d` of size `factor(d).rows()`
+        Eigen::Tensor<bry_float_t, DIM> apply(const Eigen::Tensor<bry_float_t, DIM>& tensor) const;
+
+        /// @brief Build the equivalent dense (vectorized) transformation matrix. Only intended for small sizes
+        /// @return Dense matrix
+        Matrix toMatrix() const;
+
+    private:
+        std::array<Matrix, DIM> m_factors;
+};
+
+/// @brief Apply a 1-D transformation along a single mode of a (column-major) coefficient tensor
+/// @param src Source tensor data
+/// @param dst Destination tensor data (must not alias `src`)
+/// @param src_dims Dimensions of the source tensor
+/// @param mode Dimension to apply the transformation along
+/// @param factor 1-D transformation matrix (`factor.cols()` must equal `src_dims[mode]`)
+template <std::size_t DIM>
+static BRY_INL void modeProduct(const bry_float_t* src, bry_float_t* dst, const std::array<bry_int_t, DIM>& src_dims, std::size_t mode, const Matrix& factor);
+
+}
+
+#include "impl/KroneckerTransform_impl.hpp"
@@ -141,6 +141,83 @@ class MultiIndex {
         bool m_external_arr;
 };
 
+template <std::size_t DIM>
+class StaticMultiIndexRange;
+
+/// @brief Multi index with a compile-time number of unary indices stored on the stack. Increments through all indices that are less
+/// than a multi-index bound (exhaustive when all bounds are equal), and keeps track of the wrapped index given the index constraint. The
+/// carry stops at the first unary index that does not overflow
+template <std::size_t DIM>
+class StaticMultiIndex {
+    public:
+        /// @brief Forward iterator over every multi index (for range-based for loops)
+        class Iterator {
+            public:
+                Iterator(const StaticMultiIndex& midx);
+                BRY_INL const StaticMultiIndex& operator*() const;
+                BRY_INL const StaticMultiIndex* operator->() const;
+                BRY_INL Iterator& operator++();
+                BRY_INL bool operator!=(const Iterator& other) const;
+            private:
+                StaticMultiIndex m_midx;
+        };
+
+    public:
+        /// @brief Exhaustive constructor (starts at the first index)
+        /// @param index_constraint L-infinity norm upper bound, also used as the wrapping base
+        StaticMultiIndex(bry_int_t index_constraint);
+
+        /// @brief Bounded exhaustive constructor (starts at the first index)
+        /// @param index_bounds Exclusive upper bound of each unary index
+        /// @param index_constraint Wrapping base (must be greater than or equal to each bound)
+        StaticMultiIndex(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint);
+
+        /// @brief Number of unary indices
+        static constexpr std::size_t size();
+
+        /// @brief Prefix increment. Moves the multi index along (right) by one step
+        BRY_INL StaticMultiIndex& operator++();
+
+        /// @brief Check if the last permutation is reached
+        BRY_INL bool last() const;
+
+        /// @brief Wrapped index (equivalent flattened 1D index) given the index constraint
+        BRY_INL bry_int_t wrappedIdx() const;
+
+        /// @brief Subscript operator for accessing a unary index
+        /// @param d Subscript of the individual unary index
+        BRY_INL bry_int_t operator[](std::size_t d) const;
+
+        /// @brief Access the unary indices
+        BRY_INL const std::array<bry_int_t, DIM>& idx() const;
+
+        /// @brief Vector iterator access of the unary indices
+        BRY_INL const bry_int_t* begin() const;
+
+        /// @brief Vector iterator access of the unary indices
+        BRY_INL const bry_int_t* end() const;
+
+    private:
+        friend class StaticMultiIndexRange<DIM>;
+
+        std::array<bry_int_t, DIM> m_idx;
+        std::array<bry_int_t, DIM> m_bounds;
+        std::array<bry_int_t, DIM> m_strides;
+        bry_int_t m_wrapped_idx;
+        bool m_last;
+};
+
+/// @brief Range over every index of a `StaticMultiIndex`. Usage: for (const auto& midx : smIdxRange<DIM>(n)) {...}
+template <std::size_t DIM>
+class StaticMultiIndexRange {
+    public:
+        StaticMultiIndexRange(const StaticMultiIndex<DIM>& first);
+        BRY_INL typename StaticMultiIndex<DIM>::Iterator begin() const;
+        BRY_INL typename StaticMultiIndex<DIM>::Iterator end() const;
+    private:
+        StaticMultiIndex<DIM> m_first;
+};
+
 /* Convenience methods for creating MultiIndices easily */
 BRY_INL static MultiIndex<ExhaustiveIncrementer> mIdx(std::size_t sz, bry_int_t index_constraint);
 BRY_INL static MultiIndex<ExhaustiveIncrementer> rmIdx(std::size_t sz, bry_int_t index_constraint);
@@ -150,10 +227,21 @@ BRY_INL static MultiIndex<FixedNormIncrementer> mIdxFN(std::size_t sz, bry_int_t
 BRY_INL static MultiIndex<FixedNormIncrementer> rmIdxFN(std::size_t sz, bry_int_t index_constraint);
 BRY_INL static MultiIndex<BoundedExhaustiveIncrementerWrap> mIdxBEW(const std::vector<bry_int_t>& index_bounds, bry_int_t index_constraint);
 BRY_INL static MultiIndex<BoundedExhaustiveIncrementerWrap> rmIdxBEW(const std::vector<bry_int_t>& index_bounds, bry_int_t index_constraint);
+template <std::size_t DIM>
+BRY_INL StaticMultiIndex<DIM> smIdx(bry_int_t index_constraint);
+template <std::size_t DIM>
+BRY_INL StaticMultiIndex<DIM> smIdxB(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint);
+template <std::size_t DIM>
+BRY_INL StaticMultiIndexRange<DIM> smIdxRange(bry_int_t index_constraint);
+template <std::size_t DIM>
+BRY_INL StaticMultiIndexRange<DIM> smIdxRange(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint);
 
 }
 
 template <class INCREMENTER>
 std::ostream& operator<<(std::ostream& os, const BRY::MultiIndex<INCREMENTER>& p);
 
+template <std::size_t DIM>
+std::ostream& operator<<(std::ostream& os, const BRY::StaticMultiIndex<DIM>& p);
+
 #include "impl/MultiIndex_impl.hpp"
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Instrumentation.h"
+#include "Allocator.h"
+#include "FFT.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+namespace BRY {
+
+/// @brief Different methods for multiplying (convolving) coefficient tensors
+enum class MultiplicationMethod {
+    Direct,
+    Karatsuba,
+    FFT
+};
+
+/// @brief Accuracy guarantees of polynomial products
+enum class ProductMode {
+    /// @brief Fastest method. Karatsuba and FFT products may leave roundoff noise (~1e-15) in coefficients that are exactly zero
+    Fast,
+
+    /// @brief Coefficients outside the support of the product (sums of the nonzero exponents of the factors) are exactly zero
+    ExactSupport
+};
+
+/// @brief Current (process-wide) product mode used by `operator*` and `operator^`
+BRY_INL ProductMode productMode();
+
+/// @brief Set the process-wide product mode
+BRY_INL void setProductMode(ProductMode mode);
+
+/// @brief Crossover degrees between the multiplication methods. The method is selected by the degree of the smaller factor
+struct MultiplicationThresholds {
+    /// @brief Smallest degree that is multiplied with Karatsuba (also the degree below which Karatsuba recursion stops)
+    bry_int_t karatsuba;
+
+    /// @brief Smallest degree that is multiplied with FFT
+    bry_int_t fft;
+};
+
+/// @brief Size-adaptive multiplication of coefficient tensors. Small factors use the (exact) direct convolution, medium
+/// factors use multivariate Karatsuba, and large factors use real-input FFTs
+template <std::size_t DIM>
+class Multiplication {
+    public:
+        /// @brief Thresholds measured with `bench/multiplication_calibration.cpp`
+        static constexpr MultiplicationThresholds defaultThresholds();
+
+        /// @brief Current thresholds (process-wide, per DIM)
+        static MultiplicationThresholds thresholds();
+
+        /// @brief Tune the thresholds (e.g. with the calibration benchmark output for the host machine)
+        /// @param thresholds Crossover degrees. Use `karatsuba >= fft` to disable Karatsuba
+        static void setThresholds(const MultiplicationThresholds& thresholds);
+
+        /// @brief Method that the dispatcher uses for two factors
+        /// @param degree_1 Degree of the first factor
+        /// @param degree_2 Degree of the second factor
+        /// @return Multiplication method
+        static MultiplicationMethod select(bry_int_t degree_1, bry_int_t degree_2);
+
+        /// @brief Multiply two coefficient tensors with the method selected by the thresholds. Sparse factors are treated
+        /// like dense factors with the same number of nonzero coefficients, and in `ProductMode::ExactSupport` the Karatsuba
+        /// and FFT products are cleaned up with the support of the product
+        /// @param a Coefficient tensor
+        /// @param b Coefficient tensor
+        /// @return Product coefficient tensor with dimension `d` of size `a.dimension(d) + b.dimension(d) - 1`
+        static Eigen::Tensor<bry_float_t, DIM> multiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        /// @brief Multiply two coefficient tensors into a destination tensor (same method selection as `multiply`). The storage of
+        /// `result` is reused if it already has the dimensions of the product (direct and Karatsuba products)
+        /// @param a Coefficient tensor
+        /// @param b Coefficient tensor
+        /// @param result Product coefficient tensor (may alias `a` or `b`)
+        static void multiplyInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result);
+
+        /// @brief Multiply two coefficient tensors with a given method
+        static Eigen::Tensor<bry_float_t, DIM> multiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, MultiplicationMethod method);
+
+        /// @brief Schoolbook convolution (zero coefficients of `a` are skipped)
+        static Eigen::Tensor<bry_float_t, DIM> direct(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        /// @brief Multivariate Karatsuba, splitting one dimension per recursion level until the degree along the split
+        /// dimension is below the Karatsuba threshold
+        static Eigen::Tensor<bry_float_t, DIM> karatsuba(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        /// @brief Raise a coefficient tensor to a power. Uses exponentiation by squaring with `multiply` when the final squaring
+        /// is below the FFT threshold, otherwise uses integer power by squaring on one padded spectrum (`fftPower`)
+        /// @param a Coefficient tensor
+        /// @param exp Exponent
+        /// @return Power coefficient tensor with dimension `d` of size `exp * (a.dimension(d) - 1) + 1`
+        static Eigen::Tensor<bry_float_t, DIM> power(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp);
+
+        /// @brief Compute every power of a coefficient tensor up to a maximum exponent. Uses repeated multiplication by `a` when
+        /// it is below the FFT threshold, otherwise computes every power from one padded spectrum (`fftPowers`)
+        /// @param a Coefficient tensor
+        /// @param max_exp Maximum exponent
+        /// @return Coefficient tensors of `a^0, a^1, ..., a^max_exp`
+        static std::vector<Eigen::Tensor<bry_float_t, DIM>> powers(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t max_exp);
+
+        /// @brief Support (nonzero pattern) of the product of two coefficient tensors
+        /// @param a Coefficient tensor
+        /// @param b Coefficient tensor
+        /// @return True for every coefficient of `a * b` that is a sum of products of nonzero coefficients
+        static Eigen::Tensor<bool, DIM> support(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        /// @brief Support (nonzero pattern) of the power of a coefficient tensor
+        /// @param a Coefficient tensor
+        /// @param exp Exponent
+        /// @return True for every coefficient of `a^exp` that is a sum of products of nonzero coefficients
+        static Eigen::Tensor<bool, DIM> powerSupport(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp);
+
+    private:
+        /// @brief Direct product written into `result` (must not alias `a` or `b`)
+        static void directInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result);
+
+        /// @brief Karatsuba product written into `result` (must not alias `a` or `b`)
+        static void karatsubaInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result);
+
+        static BRY_INL std::array<bry_int_t, DIM> productDimensions(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        static BRY_INL bry_int_t maxDegree(const Eigen::Tensor<bry_float_t, DIM>& t);
+
+        /// @brief Degree of the uniform dense tensor with the same number of nonzero coefficients
+        static BRY_INL bry_int_t effectiveDegree(const Eigen::Tensor<bry_float_t, DIM>& t, bry_int_t n_nonzero);
+
+        /// @brief Product of two 0/1 indicator tensors with every positive count set to 1
+        static Eigen::Tensor<bry_float_t, DIM> indicatorProduct(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b);
+
+        static BRY_INL Eigen::Tensor<bry_float_t, DIM> indicator(const Eigen::Tensor<bry_float_t, DIM>& t);
+
+    private:
+        static inline std::atomic<bry_int_t> s_karatsuba_threshold{defaultThresholds().karatsuba};
+        static inline std::atomic<bry_int_t> s_fft_threshold{defaultThresholds().fft};
+};
+
+}
+
+#include "impl/Multiplication_impl.hpp"
@@ -2,16 +2,28 @@
 
 #include "Options.h"
 #include "Types.h"
+#include "Instrumentation.h"
 #include "MultiIndex.h"
+#include "OperatorCache.h"
 
 #include <vector>
+#include <memory>
 
 namespace BRY {
 
+/// @brief Factorial (table lookup, must not exceed 20! to fit in 64 bits)
 static BRY_INL std::size_t factorial(std::size_t n);
 
+/// @brief Binomial coefficient (n choose k). Rows below `BRY_BINOM_TABLE_SIZE` are looked up in a precomputed Pascal triangle, 
+/// larger rows are computed without intermediate overflow
 static BRY_INL std::size_t binom(std::size_t n, std::size_t k);
 
+/// @brief Binomial coefficient (n choose k) in floating point (does not overflow for large `n`)
+static BRY_INL bry_float_t binomFloat(std::size_t n, std::size_t k);
+
+/// @brief Reciprocal of the binomial coefficient 1 / (n choose k) (precomputed for rows below `BRY_BINOM_TABLE_SIZE`)
+static BRY_INL bry_float_t binomReciprocal(std::size_t n, std::size_t k);
+
 /// @brief Creates a vector of all binomial coefficients (n'th row of Pascal's triangle)
 /// of the form [(n choose 0), (n choose 1), ..., (n choose n)]
 /// @param n 
@@ -52,6 +64,27 @@ static BRY_INL Eigen::Tensor<bry_float_t, DIM> makeIncrementTensor(const std::ar
 template <std::size_t DIM>
 static Matrix makeDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg);
 
+/// @brief Cached version of `makeDegreeChangeTransform` shared through the process-wide operator cache
+/// @param from_deg Degree of the input polynomial
+/// @param to_deg Degree of the output polynomial
+/// @return Shared immutable transformation matrix
+template <std::size_t DIM>
+static std::shared_ptr<const Matrix> cachedDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg);
+
+/// @brief Sparse version of `makeDegreeChangeTransform` (at most one nonzero per column)
+/// @param from_deg Degree of the input polynomial
+/// @param to_deg Degree of the output polynomial
+/// @return Sparse transformation matrix
+template <std::size_t DIM>
+static SparseMatrix makeSparseDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg);
+
+/// @brief Cached version of `makeSparseDegreeChangeTransform` shared through the process-wide operator cache
+/// @param from_deg Degree of the input polynomial
+/// @param to_deg Degree of the output polynomial
+/// @return Shared immutable sparse transformation matrix
+template <std::size_t DIM>
+static std::shared_ptr<const SparseMatrix> cachedSparseDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg);
+
 }
 
 #include "impl/Operations_impl.hpp"
\ No newline at end of file
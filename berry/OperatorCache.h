@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "KroneckerTransform.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace BRY {
+
+/// @brief Different operators that are memoized by the operator cache
+enum class OperatorType {
+    PwrToBernMatrix,
+    BernToPwrMatrix,
+    PwrToBernTransform,
+    BernToPwrTransform,
+    DegreeChangeMatrix,
+    SparsePwrToBernMatrix,
+    SparseBernToPwrMatrix,
+    SparseDegreeChangeMatrix
+};
+
+/// @brief Uniquely identifies a cached operator
+struct OperatorKey {
+    OperatorType type;
+    std::size_t dim;
+    bry_int_t degree;
+
+    /// @brief Degree increase of the operator (`to_deg - from_deg` for degree changes)
+    bry_int_t degree_increase;
+
+    bool operator==(const OperatorKey& other) const = default;
+};
+
+/// @brief Process-wide, thread-safe memoization of transformation operators. Operators are shared and immutable, and
+/// the least recently used operators are evicted once the total size of the cached operators exceeds the capacity
+class OperatorCache {
+    public:
+        /// @brief Cache usage counters
+        struct Statistics {
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            std::size_t evictions = 0;
+
+            /// @brief Number of cached operators
+            std::size_t entries = 0;
+
+            /// @brief Total size of the cached operators (bytes)
+            std::size_t bytes = 0;
+
+            /// @brief Maximum total size of the cached operators (bytes)
+            std::size_t capacity = 0;
+        };
+
+    public:
+        /// @brief Access the process-wide cache
+        static BRY_INL OperatorCache& instance();
+
+        /// @brief Get a cached operator, or build and cache it if it does not exist
+        /// @tparam T Operator type (the same key must always be fetched with the same type)
+        /// @param key Key of the operator
+        /// @param build Callable with signature `T()` that constructs the operator on a miss
+        /// @return Shared immutable operator
+        template <typename T, typename BUILDER>
+        std::shared_ptr<const T> fetch(const OperatorKey& key, BUILDER&& build);
+
+        /// @brief Set the maximum total size of the cached operators. Evicts operators if the new capacity is exceeded
+        /// @param capacity Capacity in bytes
+        BRY_INL void setCapacity(std::size_t capacity);
+
+        /// @brief Remove all cached operators (operators currently in use remain valid)
+        BRY_INL void clear();
+
+        /// @brief Get a snapshot of the cache usage counters
+        BRY_INL Statistics statistics() const;
+
+        /// @brief Reset the hit, miss and eviction counters
+        BRY_INL void resetStatistics();
+
+    private:
+        struct KeyHash {
+            BRY_INL std::size_t operator()(const OperatorKey& key) const;
+        };
+
+        struct Entry {
+            OperatorKey key;
+            std::shared_ptr<const void> op;
+            std::size_t bytes;
+        };
+
+    private:
+        BRY_INL OperatorCache(std::size_t capacity);
+
+        /// @brief Evict least recently used operators until the cached size is under `capacity` (must hold the lock)
+        BRY_INL void evictTo(std::size_t capacity);
+
+    private:
+        mutable std::mutex m_mutex;
+
+        /// @brief Entries ordered by most recent use (front is most recent)
+        std::list<Entry> m_lru;
+        std::unordered_map<OperatorKey, std::list<Entry>::iterator, KeyHash> m_entries;
+
+        std::size_t m_capacity;
+        std::size_t m_bytes = 0;
+        std::size_t m_hits = 0;
+        std::size_t m_misses = 0;
+        std::size_t m_evictions = 0;
+};
+
+}
+
+#include "impl/OperatorCache_impl.hpp"
@@ -1,28 +1,70 @@
 #pragma once
 
-/* Enable bounds checking */
-#define BRY_ENABLE_BOUNDS_CHECK
+/* Performance profile: removes bounds checks and asserts from every hot path (set by `BRY_PROFILE=Performance` in CMake). The 
+checks can still be turned back on by defining `BRY_ENABLE_BOUNDS_CHECK` */
+//#define BRY_PERFORMANCE_PROFILE
+
+#ifndef BRY_PERFORMANCE_PROFILE
+    /* Enable bounds checking and asserts (`BRY_ASSERT`) */
+    #ifndef BRY_ENABLE_BOUNDS_CHECK
+        #define BRY_ENABLE_BOUNDS_CHECK
+    #endif
+#endif
 
 /* Enable inline */
 #define BRY_ENABLE_INL
 
-/* Enable asserts */
-#define BRY_ASSERTS
-
-/* Enable debug tools */
-#define BRY_DEBUG_TOOLS
-
 /* Enable logging in color */
 #define BRY_LOG_COLOR
 
-#define EIGEN_FFTW_DEFAULT
+/* Use FFTW as the backend of Eigen::FFT (requires linking fftw3), otherwise the built-in kissfft is used */
+//#define BRY_USE_FFTW
+
+#ifdef BRY_USE_FFTW
+    #define EIGEN_FFTW_DEFAULT
+#endif
 
 /* Floating point difference tolerance */
 #define BRY_FLOAT_DIFF_TOL 1.0e-12
 
+/* Number of points evaluated together (SIMD lanes) in batched polynomial evaluation */
+#define BRY_EVAL_BLOCK_SIZE 16
+
+/* Default capacity (bytes) of the process-wide operator cache */
+#define BRY_OPERATOR_CACHE_CAPACITY (256ul * 1024ul * 1024ul)
+
+/* Maximum number of FFT plans cached per thread (least recently used plans are evicted) */
+#define BRY_FFT_PLAN_CACHE_SIZE 32
+
+/* Recycle the coefficient tensors of polynomials through a thread-local tensor pool */
+//#define BRY_ENABLE_TENSOR_POOL
+
+/* Maximum number of cached tensors of each size in a tensor pool */
+#define BRY_TENSOR_POOL_MAX_PER_SIZE 8
+
+/* Maximum total size (bytes) of the cached tensors in a tensor pool */
+#define BRY_TENSOR_POOL_MAX_BYTES (64ul * 1024ul * 1024ul)
+
+/* Minimum size (bytes) of each chunk reserved by an arena */
+#define BRY_ARENA_CHUNK_SIZE (1024ul * 1024ul)
+
+/* Record call counts, time, tensor sizes and allocations of the public operations (see Instrumentation.h) */
+//#define BRY_ENABLE_INSTRUMENTATION
+
+/* Number of rows of the precomputed Pascal triangle (binomial coefficients with n < 68 fit in 64 bits) */
+#define BRY_BINOM_TABLE_SIZE 68
+
 
 #ifdef BRY_ENABLE_INL
     #define BRY_INL inline
-#elif
+#else
     #define BRY_INL
+#endif
+
+/* Checked assertion, compiled out entirely unless bounds checking is enabled (the condition stays an unevaluated operand so that 
+the variables it names are still used) */
+#ifdef BRY_ENABLE_BOUNDS_CHECK
+    #define BRY_ASSERT(condition, message) ASSERT(condition, message)
+#else
+    #define BRY_ASSERT(condition, message) static_cast<void>(sizeof(condition))
 #endif
\ No newline at end of file
@@ -2,6 +2,11 @@
 
 #include "Options.h"
 #include "Types.h"
+#include "KroneckerTransform.h"
+#include "DegreeChangeTransform.h"
+#include "Allocator.h"
+#include "Instrumentation.h"
+#include "TaskScheduler.h"
 
 #include <vector>
 #include <array>
@@ -31,6 +36,12 @@ namespace BRY {
 template <std::size_t DIM, BRY::Basis BASIS>
 class Polynomial;
 
+template <std::size_t DIM, typename DERIVED>
+class PolynomialExpression;
+
+template <std::size_t DIM>
+void multiply(const Polynomial<DIM, Basis::Power>& p_1, const Polynomial<DIM, Basis::Power>& p_2, Polynomial<DIM, Basis::Power>& dest);
+
 }
 
 template <std::size_t DIM>
@@ -84,6 +95,19 @@ class Polynomial {
         /// @param tensor Tensor of coefficients 
         Polynomial(const Vector& vector);
 
+        /// @brief Construct polynomial by evaluating a lazy expression (see PolynomialExpression.h)
+        /// @param expr Linear combination of power basis polynomials
+        template <typename DERIVED>
+        Polynomial(const PolynomialExpression<DIM, DERIVED>& expr);
+
+        Polynomial(const Polynomial& other);
+        Polynomial(Polynomial&& other) = default;
+        Polynomial& operator=(const Polynomial& other) = default;
+        Polynomial& operator=(Polynomial&& other) = default;
+
+        /// @brief Returns the coefficient storage to the thread-local tensor pool (if `BRY_ENABLE_TENSOR_POOL` is defined)
+        ~Polynomial();
+
         /// @brief Get the degree
         /// @return Degree
         BRY_INL bry_int_t degree() const;
@@ -104,7 +128,8 @@ class Polynomial {
         BRY_INL bry_float_t coeff(DEGS ... exponents) const;
         BRY_INL bry_float_t coeff(const std::array<bry_int_t, DIM>& exponents) const;
 
-        /// @brief Evaluate the polynomial for given x vector
+        /// @brief Evaluate the polynomial for given x vector (Bernstein basis polynomials are evaluated directly using de Casteljau's 
+        /// algorithm, and are defined on the unit box [0, 1]^DIM)
         /// @tparam ...FLTS 
         /// @param ...x `x` values
         /// @return Scalar 
@@ -113,6 +138,18 @@ class Polynomial {
         bry_float_t operator()(const std::array<bry_float_t, DIM>& x) const;
         BRY_INL bry_float_t operator()(const Eigen::Vector<bry_float_t, DIM>& x) const;
 
+        /// @brief Evaluate the polynomial at many points at once. Points are processed in blocks of `BRY_EVAL_BLOCK_SIZE` 
+        /// (structure-of-arrays) using nested Horner's method (power basis) or nested de Casteljau's algorithm (Bernstein basis)
+        /// @param points Matrix where each column is an `x` vector
+        /// @return Vector of the value at each point
+        Vector evaluate(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points) const;
+
+        /// @brief Evaluate the polynomial at many points at once, distributing the blocks of points across a task scheduler
+        /// @param points Matrix where each column is an `x` vector
+        /// @param scheduler Scheduler to run the blocks on
+        /// @return Vector of the value at each point
+        Vector evaluate(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points, TaskScheduler& scheduler) const;
+
         /// @brief Compute the (partial) derivative of the polynomial with respect to a given dimension
         /// @param dx_idx Dimension to take the partial derivative with respect to
         /// @return Derivative polynomial (with the same degree)
@@ -123,6 +160,44 @@ class Polynomial {
         /// @return Raised degree polynomial
         Polynomial<DIM, BASIS> liftDegree(bry_int_t raised_deg) const;
 
+        /// @brief Add a polynomial in place. The coefficients are only reallocated if `p` has a larger degree
+        /// @param p Power basis polynomial
+        Polynomial& operator+=(const Polynomial& p);
+
+        /// @brief Subtract a polynomial in place. The coefficients are only reallocated if `p` has a larger degree
+        /// @param p Power basis polynomial
+        Polynomial& operator-=(const Polynomial& p);
+
+        /// @brief Add a constant in place (power basis)
+        BRY_INL Polynomial& operator+=(bry_float_t scalar);
+
+        /// @brief Subtract a constant in place (power basis)
+        BRY_INL Polynomial& operator-=(bry_float_t scalar);
+
+        /// @brief Multiply by a scalar in place
+        BRY_INL Polynomial& operator*=(bry_float_t scalar);
+
+        /// @brief Replace the polynomial with its (partial) derivative without reallocating
+        /// @param dx_idx Dimension to take the partial derivative with respect to
+        void derivativeInPlace(bry_int_t dx_idx);
+
+        /// @brief Raise the degree by padding the higher order terms as zero-coefficients (reallocates unless the degree is unchanged)
+        /// @param raised_deg New degree (must be larger than or equal to `degree()`)
+        void liftDegreeInPlace(bry_int_t raised_deg);
+
+        /// @brief Create a copy under the affine change of variables `x_d = shift[d] + scale[d] * t_d` (power basis). For example, 
+        /// `shift = a` and `scale = b - a` maps the box [a, b] onto the unit box. Each mode is Taylor shifted and then scaled, which
+        /// costs O(DIM * n^(DIM + 1)) for `n = degree() + 1` instead of expanding the powers of the substituted variables
+        /// @param shift Shift of each variable
+        /// @param scale Scale of each variable
+        /// @return Reparameterized polynomial (with the same degree)
+        Polynomial<DIM, BASIS> reparameterize(const std::array<bry_float_t, DIM>& shift, const std::array<bry_float_t, DIM>& scale) const;
+
+        /// @brief Apply the affine change of variables `x_d = shift[d] + scale[d] * t_d` without reallocating (power basis)
+        /// @param shift Shift of each variable
+        /// @param scale Scale of each variable
+        void reparameterizeInPlace(const std::array<bry_float_t, DIM>& shift, const std::array<bry_float_t, DIM>& scale);
+
         /// @brief Get the Number of monomials
         bry_int_t nMonomials() const;
 
@@ -131,6 +206,10 @@ class Polynomial {
         BRY_INL const Eigen::Tensor<bry_float_t, DIM>& tensor() const;
 
         friend std::ostream& operator<<<DIM>(std::ostream& os, const Polynomial& p);
+        friend void multiply<DIM>(const Polynomial<DIM, Basis::Power>& p_1, const Polynomial<DIM, Basis::Power>& p_2, Polynomial<DIM, Basis::Power>& dest);
+
+    private:
+        Vector evaluateBatch(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points, TaskScheduler* scheduler) const;
 
     private:
         Eigen::Tensor<bry_float_t, DIM> m_tensor;
@@ -146,6 +225,49 @@ class Polynomial {
 template <std::size_t DIM, Basis FROM_BASIS, Basis TO_BASIS = Basis::Power>
 BRY::Polynomial<DIM, TO_BASIS> transform(const BRY::Polynomial<DIM, FROM_BASIS>& p, const Matrix& transform_matrix);
 
+/// @brief Linearly transform the coefficients of a polynomial using a sparse transformation matrix
+/// @tparam FROM_BASIS Basis of existing polynomial
+/// @tparam TO_BASIS Basis of returned polynomial
+/// @param p Polynomial
+/// @param transform_matrix Sparse transformation in vectorized form
+/// @return Transformed polynomial
+template <std::size_t DIM, Basis FROM_BASIS, Basis TO_BASIS = Basis::Power>
+BRY::Polynomial<DIM, TO_BASIS> transform(const BRY::Polynomial<DIM, FROM_BASIS>& p, const SparseMatrix& transform_matrix);
+
+/// @brief Change the degree of a polynomial (the coefficients are copied, the basis is unchanged)
+/// @tparam FROM_BASIS Basis of existing polynomial
+/// @tparam TO_BASIS Basis of returned polynomial
+/// @param p Polynomial
+/// @param transformation Degree change index map
+/// @return Polynomial of degree `transformation.toDegree()`
+template <std::size_t DIM, Basis FROM_BASIS, Basis TO_BASIS = FROM_BASIS>
+BRY::Polynomial<DIM, TO_BASIS> transform(const BRY::Polynomial<DIM, FROM_BASIS>& p, const DegreeChangeTransform<DIM>& transformation);
+
+/// @brief Linearly transform the coefficients of a polynomial using a Kronecker product of 1-D transformations
+/// @tparam FROM_BASIS Basis of existing polynomial
+/// @tparam TO_BASIS Basis of returned polynomial
+/// @param p Polynomial
+/// @param transformation Transformation applied mode-by-mode on the coefficient tensor
+/// @return Transformed polynomial
+template <std::size_t DIM, Basis FROM_BASIS, Basis TO_BASIS = Basis::Power>
+BRY::Polynomial<DIM, TO_BASIS> transform(const BRY::Polynomial<DIM, FROM_BASIS>& p, const KroneckerTransform<DIM>& transformation);
+
+/// @brief Multiply two polynomials into a destination polynomial, reusing the coefficient storage of `dest` if it already has the
+/// degree of the product (e.g. in accumulation loops)
+/// @param p_1 Polynomial
+/// @param p_2 Polynomial
+/// @param dest Product polynomial of degree `p_1.degree() + p_2.degree()` (may be `p_1` or `p_2`)
+template <std::size_t DIM>
+void multiply(const Polynomial<DIM, Basis::Power>& p_1, const Polynomial<DIM, Basis::Power>& p_2, Polynomial<DIM, Basis::Power>& dest);
+
+/// @brief Compute every power of a polynomial up to a maximum exponent (e.g. for polynomial composition). Large powers share
+/// one padded FFT spectrum
+/// @param p Polynomial
+/// @param max_exp Maximum exponent
+/// @return Polynomials `p^0, p^1, ..., p^max_exp`
+template <std::size_t DIM>
+std::vector<BRY::Polynomial<DIM, Basis::Power>> powers(const BRY::Polynomial<DIM, Basis::Power>& p, bry_int_t max_exp);
+
 }
 
 #include "impl/Polynomial_impl.hpp"
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Polynomial.h"
+
+#include <array>
+
+/* Forward Declarations */
+namespace BRY {
+
+template <std::size_t DIM, typename DERIVED>
+class PolynomialExpression;
+
+template <std::size_t DIM>
+class PolynomialTerm;
+
+template <std::size_t DIM>
+class PolynomialConstant;
+
+template <std::size_t DIM, typename EXPR>
+class PolynomialScaled;
+
+template <std::size_t DIM, typename LHS, typename RHS>
+class PolynomialSum;
+
+template <std::size_t DIM, typename LHS, typename RHS>
+class PolynomialDifference;
+
+}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialSum<DIM, LHS, RHS> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialSum<DIM, LHS, BRY::PolynomialTerm<DIM>> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::Polynomial<DIM, BRY::Basis::Power>& p);
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialSum<DIM, BRY::PolynomialTerm<DIM>, RHS> operator+(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialSum<DIM, LHS, BRY::PolynomialConstant<DIM>> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, BRY::bry_float_t scalar);
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialSum<DIM, BRY::PolynomialConstant<DIM>, RHS> operator+(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialDifference<DIM, LHS, RHS> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialTerm<DIM>> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::Polynomial<DIM, BRY::Basis::Power>& p);
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialDifference<DIM, BRY::PolynomialTerm<DIM>, RHS> operator-(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialConstant<DIM>> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, BRY::bry_float_t scalar);
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialDifference<DIM, BRY::PolynomialConstant<DIM>, RHS> operator-(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, RHS>& rhs);
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator-(const BRY::PolynomialExpression<DIM, EXPR>& expr);
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator*(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, EXPR>& expr);
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator*(const BRY::PolynomialExpression<DIM, EXPR>& expr, BRY::bry_float_t scalar);
+
+namespace BRY {
+
+/// @brief Lazy linear combination of power basis polynomials. An expression only captures the operator tree (operand polynomials
+/// are referenced, not copied), and is evaluated when converted to a `Polynomial`: the result is allocated once with the maximum
+/// degree of the operands, and filled in a single sweep over its contiguous runs along dimension 0 where every operand adds its
+/// matching run. Usage: Polynomial<DIM> p = 2.0 * lazy(x) + 3.0 * lazy(y) - z + 1.0;
+/// NOTE: The operand polynomials must outlive the expression (do not store expressions of temporaries)
+template <std::size_t DIM, typename DERIVED>
+class PolynomialExpression {
+    public:
+        /// @brief Access the concrete expression
+        BRY_INL const DERIVED& derived() const;
+
+        /// @brief Degree of the evaluated polynomial
+        BRY_INL bry_int_t degree() const;
+
+        /// @brief Evaluate the expression
+        /// @return Coefficient tensor with every dimension of size `degree() + 1`
+        Eigen::Tensor<bry_float_t, DIM> tensor() const;
+
+        /// @brief Evaluate the expression
+        /// @return Polynomial
+        Polynomial<DIM, Basis::Power> eval() const;
+};
+
+/// @brief Polynomial operand of an expression (held by reference)
+template <std::size_t DIM>
+class PolynomialTerm : public PolynomialExpression<DIM, PolynomialTerm<DIM>> {
+    public:
+        PolynomialTerm(const Polynomial<DIM, Basis::Power>& p);
+
+        BRY_INL bry_int_t degree() const;
+
+        /// @brief Add the weighted run of the operand matching a run of the result
+        /// @param run Coefficients of the result along dimension 0
+        /// @param idx Multi index of the first coefficient of the run (`idx[0] == 0`)
+        /// @param weight Product of the scalars applied to the operand
+        BRY_INL void accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const;
+
+    private:
+        const Polynomial<DIM, Basis::Power>& m_p;
+};
+
+/// @brief Constant operand of an expression
+template <std::size_t DIM>
+class PolynomialConstant : public PolynomialExpression<DIM, PolynomialConstant<DIM>> {
+    public:
+        PolynomialConstant(bry_float_t value);
+
+        BRY_INL bry_int_t degree() const;
+        BRY_INL void accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const;
+
+    private:
+        bry_float_t m_value;
+};
+
+/// @brief Scalar multiple (or negation) of an expression
+template <std::size_t DIM, typename EXPR>
+class PolynomialScaled : public PolynomialExpression<DIM, PolynomialScaled<DIM, EXPR>> {
+    public:
+        PolynomialScaled(const EXPR& expr, bry_float_t scalar);
+
+        BRY_INL bry_int_t degree() const;
+        BRY_INL void accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const;
+
+    private:
+        EXPR m_expr;
+        bry_float_t m_scalar;
+};
+
+/// @brief Sum of two expressions
+template <std::size_t DIM, typename LHS, typename RHS>
+class PolynomialSum : public PolynomialExpression<DIM, PolynomialSum<DIM, LHS, RHS>> {
+    public:
+        PolynomialSum(const LHS& lhs, const RHS& rhs);
+
+        BRY_INL bry_int_t degree() const;
+        BRY_INL void accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const;
+
+    private:
+        LHS m_lhs;
+        RHS m_rhs;
+};
+
+/// @brief Difference of two expressions
+template <std::size_t DIM, typename LHS, typename RHS>
+class PolynomialDifference : public PolynomialExpression<DIM, PolynomialDifference<DIM, LHS, RHS>> {
+    public:
+        PolynomialDifference(const LHS& lhs, const RHS& rhs);
+
+        BRY_INL bry_int_t degree() const;
+        BRY_INL void accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const;
+
+    private:
+        LHS m_lhs;
+        RHS m_rhs;
+};
+
+/// @brief Start a lazy expression from a polynomial
+/// @param p Polynomial (must outlive the expression)
+/// @return Expression operand
+template <std::size_t DIM>
+PolynomialTerm<DIM> lazy(const Polynomial<DIM, Basis::Power>& p);
+
+template <std::size_t DIM>
+PolynomialTerm<DIM> lazy(Polynomial<DIM, Basis::Power>&& p) = delete;
+
+}
+
+#include "impl/PolynomialExpression_impl.hpp"
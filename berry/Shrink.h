@@ -3,6 +3,7 @@
 #include "Options.h"
 #include "Types.h"
 #include "Polynomial.h"
+#include "BernsteinTransform.h"
 
 #include <vector>
 #include <array>
@@ -12,15 +13,17 @@ namespace BRY {
 
 namespace Shrink {
 
-/// @brief Reduce degree of polynomial by simply pruning higher order terms
+/// @brief Reduce degree of polynomial by simply pruning higher order terms (every term with an exponent above `new_degree`)
 /// @tparam DIM Dimension of polynomial
 /// @param p Polynomial to shrink
 /// @param new_degree Degree of the shrunken polynomial
-/// @return Reduced degree polynomial
+/// @return Reduced degree polynomial (a copy of `p` if `new_degree` is not smaller than `p.degree()`)
 template <std::size_t DIM>
 static Polynomial<DIM, Basis::Power> pruneHigherOrder(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree);
 
-/// @brief Reduce degree of polynomial such that the lower order polynomial upper bounds the original on the hypercube `[0, 1]^DIM`
+/// @brief Reduce degree of polynomial such that the lower order polynomial upper bounds the original on the hypercube `[0, 1]^DIM`.
+/// The pruned terms are replaced by the largest Bernstein coefficient of the pruned part, which is a certified upper bound of the 
+/// pruned part on the hypercube
 /// @tparam DIM Dimension of polynomial
 /// @param p Polynomial to shrink
 /// @param new_degree Degree of the shrunken polynomial
@@ -28,7 +31,9 @@ static Polynomial<DIM, Basis::Power> pruneHigherOrder(const Polynomial<DIM, Basi
 template <std::size_t DIM>
 static Polynomial<DIM, Basis::Power> upperBound01(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree);
 
-/// @brief Reduce degree of polynomial such that the lower order polynomial lower bounds the original on the hypercube `[0, 1]^DIM`
+/// @brief Reduce degree of polynomial such that the lower order polynomial lower bounds the original on the hypercube `[0, 1]^DIM`.
+/// The pruned terms are replaced by the smallest Bernstein coefficient of the pruned part, which is a certified lower bound of the 
+/// pruned part on the hypercube
 /// @tparam DIM Dimension of polynomial
 /// @param p Polynomial to shrink
 /// @param new_degree Degree of the shrunken polynomial
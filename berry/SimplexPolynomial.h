@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Polynomial.h"
+
+#include <array>
+
+#include <Eigen/Core>
+
+/* Forward Declarations */
+namespace BRY {
+
+template <std::size_t DIM>
+class SimplexPolynomial;
+
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator+(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator-(const BRY::SimplexPolynomial<DIM>& p);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator-(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(BRY::bry_float_t scalar, const BRY::SimplexPolynomial<DIM>& p);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(const BRY::SimplexPolynomial<DIM>& p, BRY::bry_float_t scalar);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator^(const BRY::SimplexPolynomial<DIM>& p, BRY::bry_int_t exp);
+
+namespace BRY {
+
+/// @brief Power basis polynomial with bounded total degree (sum of the exponents of each term). Coefficients are stored in a compact
+/// vector of size `C(degree + DIM, DIM)`, ordered by total degree and then in `FixedNormIncrementer` order within each total degree. The
+/// position of a term is given by its rank in the combinatorial number system
+template <std::size_t DIM>
+class SimplexPolynomial {
+    public:
+        /// @brief Construct the zero polynomial of known total degree
+        /// @param degree Maximum total degree
+        SimplexPolynomial(bry_int_t degree);
+
+        /// @brief Construct polynomial given a ranked vector of coefficients
+        /// @param degree Maximum total degree
+        /// @param coefficients Coefficients in rank order (size `nCoefficients(degree)`)
+        SimplexPolynomial(bry_int_t degree, const Vector& coefficients);
+        SimplexPolynomial(bry_int_t degree, Vector&& coefficients);
+
+        /// @brief Construct from a dense power basis polynomial. The total degree is the largest total degree of a nonzero coefficient
+        /// @param p Dense polynomial
+        explicit SimplexPolynomial(const Polynomial<DIM, Basis::Power>& p);
+
+        /// @brief Get the (maximum) total degree
+        /// @return Total degree
+        BRY_INL bry_int_t degree() const;
+
+        /// @brief Access a specific coefficient of a term. Usage: coeff(1, 0, 3) returns the coefficient of the term (x0)(x2^3)
+        /// @param ...exponents Exponents in order of variables (total degree must not exceed `degree()`)
+        /// @return Reference to mutable value
+        template <typename ... DEGS>
+        BRY_INL bry_float_t& coeff(DEGS ... exponents);
+        BRY_INL bry_float_t& coeff(const std::array<bry_int_t, DIM>& exponents);
+
+        /// @brief Access a specific coefficient of a term. Usage: coeff(1, 0, 3) returns the coefficient of the term (x0)(x2^3)
+        /// @param ...exponents Exponents in order of variables (total degree must not exceed `degree()`)
+        /// @return Reference to imutable value
+        template <typename ... DEGS>
+        BRY_INL bry_float_t coeff(DEGS ... exponents) const;
+        BRY_INL bry_float_t coeff(const std::array<bry_int_t, DIM>& exponents) const;
+
+        /// @brief Evaluate the polynomial for given x vector
+        /// @param ...x `x` values
+        /// @return Scalar
+        template <typename ... FLTS>
+        BRY_INL bry_float_t operator()(FLTS ... x) const;
+        bry_float_t operator()(const std::array<bry_float_t, DIM>& x) const;
+        BRY_INL bry_float_t operator()(const Eigen::Vector<bry_float_t, DIM>& x) const;
+
+        /// @brief Compute the (partial) derivative of the polynomial with respect to a given dimension
+        /// @param dx_idx Dimension to take the partial derivative with respect to
+        /// @return Derivative polynomial (with the same total degree)
+        SimplexPolynomial derivative(bry_int_t dx_idx) const;
+
+        /// @brief Create a copy with a raised total degree (the higher order terms are zero)
+        /// @param raised_deg New total degree (must be larger than `degree()`)
+        /// @return Raised degree polynomial
+        SimplexPolynomial liftDegree(bry_int_t raised_deg) const;
+
+        /// @brief Get the number of monomials
+        BRY_INL bry_int_t nMonomials() const;
+
+        /// @brief Access the ranked coefficients
+        BRY_INL const Vector& coefficients() const;
+
+        /// @brief Convert to a dense power basis polynomial of degree `degree()`
+        /// @return Dense polynomial
+        Polynomial<DIM, Basis::Power> toDense() const;
+
+        /// @brief Number of coefficients of a polynomial with a given total degree, `C(degree + DIM, DIM)`
+        static BRY_INL bry_int_t nCoefficients(bry_int_t degree);
+
+        /// @brief Position of a term in the coefficient vector
+        /// @param exponents Exponents in order of variables
+        /// @return Rank
+        static BRY_INL bry_int_t rank(const std::array<bry_int_t, DIM>& exponents);
+
+        /// @brief Move the exponents to the term of the next rank
+        /// @param exponents Exponents in order of variables
+        static BRY_INL void next(std::array<bry_int_t, DIM>& exponents);
+
+    private:
+        bry_int_t m_degree;
+        Vector m_coeffs;
+};
+
+}
+
+#include "impl/SimplexPolynomial_impl.hpp"
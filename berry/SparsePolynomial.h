@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+#include "Polynomial.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+/* Forward Declarations */
+namespace BRY {
+
+template <std::size_t DIM>
+class SparsePolynomial;
+
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator+(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator-(const BRY::SparsePolynomial<DIM>& p);
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator-(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(BRY::bry_float_t scalar, const BRY::SparsePolynomial<DIM>& p);
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(const BRY::SparsePolynomial<DIM>& p, BRY::bry_float_t scalar);
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2);
+
+template <std::size_t DIM>
+std::ostream& operator<<(std::ostream& os, const BRY::SparsePolynomial<DIM>& p);
+
+namespace BRY {
+
+/// @brief Power basis polynomial that only stores its nonzero terms. Each term is a packed exponent key (the exponent of
+/// variable `d` occupies bits `d * 64 / DIM, ..., (d + 1) * 64 / DIM - 1`) and a coefficient, sorted by key. The key order
+/// is the same as the flattened coefficient order of the dense `Polynomial`, and multiplying monomials adds their keys
+template <std::size_t DIM>
+class SparsePolynomial {
+    public:
+        /// @brief Packed exponents of a term
+        typedef uint64_t Key;
+
+    public:
+        /// @brief Construct the zero polynomial
+        SparsePolynomial() = default;
+
+        /// @brief Construct from a dense power basis polynomial (zero coefficients are dropped)
+        /// @param p Dense polynomial
+        explicit SparsePolynomial(const Polynomial<DIM, Basis::Power>& p);
+
+        /// @brief Construct from a list of terms. Terms with the same exponents are summed
+        /// @param terms Exponents and coefficient of each term
+        SparsePolynomial(const std::vector<std::pair<std::array<bry_int_t, DIM>, bry_float_t>>& terms);
+
+        /// @brief Largest exponent of any variable
+        /// @return Degree
+        bry_int_t degree() const;
+
+        /// @brief Number of nonzero terms
+        BRY_INL bry_int_t nTerms() const;
+
+        /// @brief Exponents of a term
+        /// @param i Term index
+        BRY_INL std::array<bry_int_t, DIM> exponents(bry_int_t i) const;
+
+        /// @brief Coefficient of a term
+        /// @param i Term index
+        BRY_INL bry_float_t coefficient(bry_int_t i) const;
+
+        /// @brief Look up the coefficient of the term with given exponents
+        /// @param exponents Exponents in order of variables
+        /// @return Coefficient (zero if the term does not exist)
+        bry_float_t coeff(const std::array<bry_int_t, DIM>& exponents) const;
+
+        /// @brief Evaluate the polynomial for given x vector
+        /// @param x `x` values
+        /// @return Scalar
+        bry_float_t operator()(const std::array<bry_float_t, DIM>& x) const;
+        BRY_INL bry_float_t operator()(const Eigen::Vector<bry_float_t, DIM>& x) const;
+
+        /// @brief Compute the (partial) derivative of the polynomial with respect to a given dimension
+        /// @param dx_idx Dimension to take the partial derivative with respect to
+        /// @return Derivative polynomial
+        SparsePolynomial derivative(bry_int_t dx_idx) const;
+
+        /// @brief Convert to a dense power basis polynomial of degree `degree()`
+        /// @return Dense polynomial
+        Polynomial<DIM, Basis::Power> toDense() const;
+
+        /// @brief Sorted exponent keys
+        BRY_INL const std::vector<Key>& keys() const;
+
+        /// @brief Coefficients in key order
+        BRY_INL const std::vector<bry_float_t>& coefficients() const;
+
+        /// @brief Largest exponent that can be stored for each variable
+        static constexpr bry_int_t maxExponent();
+
+        /// @brief Pack exponents into a key
+        static BRY_INL Key pack(const std::array<bry_int_t, DIM>& exponents);
+
+        /// @brief Unpack a key into exponents
+        static BRY_INL std::array<bry_int_t, DIM> unpack(Key key);
+
+        friend SparsePolynomial operator+<DIM>(const SparsePolynomial& p_1, const SparsePolynomial& p_2);
+        friend SparsePolynomial operator*<DIM>(const SparsePolynomial& p_1, const SparsePolynomial& p_2);
+        friend SparsePolynomial operator*<DIM>(BRY::bry_float_t scalar, const SparsePolynomial& p);
+
+    private:
+        static constexpr std::size_t s_field_bits = 64 / DIM;
+        static constexpr Key s_field_mask = s_field_bits == 64 ? ~Key(0) : (Key(1) << s_field_bits) - 1;
+
+    private:
+        std::vector<Key> m_keys;
+        std::vector<bry_float_t> m_coeffs;
+};
+
+}
+
+#include "impl/SparsePolynomial_impl.hpp"
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Options.h"
+#include "Types.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BRY {
+
+/// @brief Work-stealing task scheduler. Each worker owns a task queue, takes its own tasks most-recent-first and steals the oldest
+/// tasks of other workers when it runs out. Threads waiting on a parallel operation execute tasks instead of blocking, so parallel
+/// operations may be nested
+class TaskScheduler {
+    public:
+        /// @brief Construct the scheduler
+        /// @param n_threads Total number of threads that execute tasks (including the thread that waits on a parallel operation)
+        BRY_INL TaskScheduler(std::size_t n_threads = std::thread::hardware_concurrency());
+
+        BRY_INL ~TaskScheduler();
+
+        /// @brief Total number of threads that execute tasks
+        BRY_INL std::size_t nThreads() const;
+
+        /// @brief Call `fn(i)` for every `i` in [begin, end) and wait for completion. Rethrows the first exception thrown by `fn`
+        /// @param begin First index
+        /// @param end One past the last index
+        /// @param fn Callable with signature `void(bry_int_t)`
+        /// @param grain Number of consecutive indices executed by one task
+        template <typename FUNC>
+        void parallelFor(bry_int_t begin, bry_int_t end, FUNC&& fn, bry_int_t grain = 1);
+
+        /// @brief Compute `fn(i)` for every `i` in [0, n). The results are ordered by index regardless of the execution order
+        /// @param n Number of results
+        /// @param fn Callable with signature `T(bry_int_t)`
+        /// @param grain Number of consecutive indices executed by one task
+        /// @return Results
+        template <typename T, typename FUNC>
+        std::vector<T> parallelMap(bry_int_t n, FUNC&& fn, bry_int_t grain = 1);
+
+        /// @brief Access the process-wide scheduler (uses all hardware threads)
+        static BRY_INL TaskScheduler& global();
+
+    private:
+        using Task = std::function<void()>;
+
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+    private:
+        /// @brief Push a task onto the queue owned by the calling thread
+        BRY_INL void submit(Task&& task);
+
+        /// @brief Run one task from the queue at `queue_idx`, or steal one from another queue
+        /// @return True if a task was run
+        BRY_INL bool tryRunTask(std::size_t queue_idx);
+
+        /// @brief Index of the queue owned by the calling thread (threads that are not workers share queue 0)
+        BRY_INL std::size_t localQueue() const;
+
+        BRY_INL void workerLoop(std::size_t queue_idx);
+
+    private:
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+
+        std::atomic<bool> m_stop;
+        std::atomic<std::size_t> m_queued;
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_sleep_cv;
+
+        /// @brief Scheduler and queue owned by the current thread if it is a worker
+        static inline thread_local const TaskScheduler* s_worker_scheduler = nullptr;
+        static inline thread_local std::size_t s_worker_queue = 0;
+};
+
+}
+
+#include "impl/TaskScheduler_impl.hpp"
@@ -5,6 +5,7 @@
 #include <tuple>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <unsupported/Eigen/CXX11/Tensor>
 
 namespace BRY {
@@ -26,5 +27,6 @@ using ExponentVec = Eigen::Vector<bry_int_t, DIM>;
 
 using Vector = Eigen::Matrix<bry_float_t, Eigen::Dynamic, 1>;
 using Matrix = Eigen::Matrix<bry_float_t, Eigen::Dynamic, Eigen::Dynamic>;
+using SparseMatrix = Eigen::SparseMatrix<bry_float_t>;
 
 }
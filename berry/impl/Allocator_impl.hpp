@@ -0,0 +1,224 @@
+#pragma once
+
+#include "Allocator.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+/* Arena */
+
+BRY::Arena::Arena(std::size_t chunk_size)
+    : m_chunk_size(chunk_size)
+{}
+
+BRY::Arena::~Arena() {
+    reset();
+    shrink();
+}
+
+BRY::Arena& BRY::Arena::threadInstance() {
+    thread_local Arena arena;
+    return arena;
+}
+
+void* BRY::Arena::allocate(std::size_t bytes, std::size_t alignment) {
+    BRY_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+    // Find the first chunk (starting at the current one) with enough aligned space. The address is aligned rather than the offset,
+    // since the chunk data is only aligned to `EIGEN_MAX_ALIGN_BYTES`
+    while (m_chunk < m_chunks.size()) {
+        const Chunk& chunk = m_chunks[m_chunk];
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(chunk.data) + m_offset;
+        std::size_t aligned_offset = m_offset + (((address + alignment - 1) & ~(alignment - 1)) - address);
+        if (aligned_offset + bytes <= chunk.size) {
+            m_offset = aligned_offset + bytes;
+            ++m_stats.allocations;
+            m_stats.bytes_allocated += bytes;
+            m_stats.bytes_in_use += bytes;
+            m_stats.peak_bytes = std::max(m_stats.peak_bytes, m_stats.bytes_in_use);
+            return chunk.data + aligned_offset;
+        }
+        ++m_chunk;
+        m_offset = 0;
+    }
+
+    // Reserve a new chunk (chunk data is aligned to at least `EIGEN_MAX_ALIGN_BYTES`)
+    std::size_t size = std::max(m_chunk_size, bytes + alignment);
+    std::byte* data = static_cast<std::byte*>(::operator new(size, std::align_val_t(EIGEN_MAX_ALIGN_BYTES)));
+    m_chunks.push_back(Chunk{data, size});
+    m_stats.system_bytes += size;
+    m_chunk = m_chunks.size() - 1;
+    m_offset = 0;
+    return allocate(bytes, alignment);
+}
+
+template <typename T>
+T* BRY::Arena::allocate(std::size_t n) {
+    return static_cast<T*>(allocate(n * sizeof(T), std::max(alignof(T), static_cast<std::size_t>(EIGEN_MAX_ALIGN_BYTES))));
+}
+
+template <std::size_t DIM>
+Eigen::TensorMap<Eigen::Tensor<BRY::bry_float_t, DIM>> BRY::Arena::allocateTensor(const std::array<bry_int_t, DIM>& dims) {
+    bry_int_t size = 1;
+    for (bry_int_t dim : dims)
+        size *= dim;
+    bry_float_t* data = allocate<bry_float_t>(size);
+    std::fill_n(data, size, 0.0);
+    return Eigen::TensorMap<Eigen::Tensor<bry_float_t, DIM>>(data, dims);
+}
+
+BRY::Arena::Marker BRY::Arena::mark() const {
+    return Marker{m_chunk, m_offset, m_stats.bytes_in_use};
+}
+
+void BRY::Arena::rewind(const Marker& marker) {
+    BRY_ASSERT(marker.chunk < m_chunk || (marker.chunk == m_chunk && marker.offset <= m_offset), "Marker is ahead of the arena");
+    m_chunk = marker.chunk;
+    m_offset = marker.offset;
+    m_stats.bytes_in_use = marker.bytes_in_use;
+}
+
+void BRY::Arena::reset() {
+    rewind(Marker{0, 0, 0});
+}
+
+void BRY::Arena::shrink() {
+    BRY_ASSERT(m_stats.bytes_in_use == 0, "Cannot shrink an arena that is in use");
+    for (const Chunk& chunk : m_chunks)
+        ::operator delete(chunk.data, std::align_val_t(EIGEN_MAX_ALIGN_BYTES));
+    m_chunks.clear();
+    m_chunk = 0;
+    m_offset = 0;
+    m_stats.system_bytes = 0;
+}
+
+BRY::AllocatorStatistics BRY::Arena::statistics() const {
+    return m_stats;
+}
+
+/* Scoped Arena */
+
+BRY::ScopedArena::ScopedArena()
+    : ScopedArena(Arena::threadInstance())
+{}
+
+BRY::ScopedArena::ScopedArena(Arena& arena)
+    : m_arena(arena)
+    , m_marker(arena.mark())
+{}
+
+BRY::ScopedArena::~ScopedArena() {
+    m_arena.rewind(m_marker);
+}
+
+BRY::Arena& BRY::ScopedArena::arena() {
+    return m_arena;
+}
+
+/* Tensor Pool */
+
+template <std::size_t DIM>
+BRY::TensorPool<DIM>::~TensorPool() {
+    alive() = false;
+}
+
+template <std::size_t DIM>
+BRY::TensorPool<DIM>* BRY::TensorPool<DIM>::threadInstance() {
+    // Polynomials may be destroyed after the thread-local pool (e.g. static objects), so the pool is only accessed while alive
+    if (!alive())
+        return nullptr;
+    thread_local TensorPool pool;
+    return &pool;
+}
+
+template <std::size_t DIM>
+bool& BRY::TensorPool<DIM>::alive() {
+    thread_local bool is_alive = true;
+    return is_alive;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::TensorPool<DIM>::acquire(const std::array<bry_int_t, DIM>& dims) {
+    bry_int_t size = 1;
+    for (bry_int_t dim : dims)
+        size *= dim;
+
+    auto it = m_free.find(size);
+    if (it == m_free.end()) {
+        ++m_stats.misses;
+        m_stats.bytes_allocated += size * sizeof(bry_float_t);
+        return Eigen::Tensor<bry_float_t, DIM>(dims);
+    }
+
+    ++m_stats.hits;
+    --m_stats.cached;
+    m_stats.cached_bytes -= size * sizeof(bry_float_t);
+
+    // Resizing to the same number of coefficients keeps the storage
+    Eigen::Tensor<bry_float_t, DIM> tensor = std::move(it->second.back());
+    it->second.pop_back();
+    if (it->second.empty())
+        m_free.erase(it);
+    tensor.resize(dims);
+    return tensor;
+}
+
+template <std::size_t DIM>
+void BRY::TensorPool<DIM>::recycle(Eigen::Tensor<bry_float_t, DIM>&& tensor) {
+    bry_int_t size = tensor.size();
+    if (size == 0)
+        return;
+
+    std::size_t bytes = size * sizeof(bry_float_t);
+    if (m_stats.cached_bytes + bytes > BRY_TENSOR_POOL_MAX_BYTES)
+        return;
+
+    std::vector<Eigen::Tensor<bry_float_t, DIM>>& free_list = m_free[size];
+    if (free_list.size() >= BRY_TENSOR_POOL_MAX_PER_SIZE)
+        return;
+
+    free_list.push_back(std::move(tensor));
+    ++m_stats.cached;
+    m_stats.cached_bytes += bytes;
+    m_stats.peak_cached_bytes = std::max(m_stats.peak_cached_bytes, m_stats.cached_bytes);
+}
+
+template <std::size_t DIM>
+void BRY::TensorPool<DIM>::clear() {
+    m_free.clear();
+    m_stats.cached = 0;
+    m_stats.cached_bytes = 0;
+}
+
+template <std::size_t DIM>
+typename BRY::TensorPool<DIM>::Statistics BRY::TensorPool<DIM>::statistics() const {
+    return m_stats;
+}
+
+namespace _BRY {
+
+/// @brief Create an (uninitialized) coefficient tensor, drawing from the thread-local tensor pool if enabled
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> makeTensor(const std::array<BRY::bry_int_t, DIM>& dims) {
+#ifdef BRY_ENABLE_TENSOR_POOL
+    if (BRY::TensorPool<DIM>* pool = BRY::TensorPool<DIM>::threadInstance())
+        return pool->acquire(dims);
+#endif
+    return Eigen::Tensor<BRY::bry_float_t, DIM>(dims);
+}
+
+/// @brief Return the storage of a coefficient tensor to the thread-local tensor pool if enabled
+template <std::size_t DIM>
+void recycleTensor(Eigen::Tensor<BRY::bry_float_t, DIM>&& tensor) {
+#ifdef BRY_ENABLE_TENSOR_POOL
+    if (BRY::TensorPool<DIM>* pool = BRY::TensorPool<DIM>::threadInstance())
+        pool->recycle(std::move(tensor));
+#else
+    static_cast<void>(tensor);
+#endif
+}
+
+}
@@ -7,79 +7,207 @@
 
 #include "lemon/Logging.h"
 
+std::size_t BRY::BoundWorkspace::capacity() const {
+    return m_buffer_a.size();
+}
+
+void BRY::BoundWorkspace::reserve(std::size_t size) {
+    if (m_buffer_a.size() < size) {
+        m_buffer_a.resize(size);
+        m_buffer_b.resize(size);
+    }
+}
+
 //template <std::size_t DIM>
 //Polynomial<DIM, BRY::Basis::Bernstein> BRY::BernsteinBasisTransform<DIM>::to(const Polynomial<DIM, BRY::Basis::Power>& p, BRY::bry_int_t degree_increase = 0) {
 //    
 //}
 
 template <std::size_t DIM>
-BRY::Matrix BRY::BernsteinBasisTransform<DIM>::pwrToBernMatrix(bry_int_t degree, bry_int_t degree_increase) {
-    bry_int_t to_degree = degree + degree_increase;
-    auto makeCoeff = [&] (const auto& i_midx, const auto& l_midx) -> bry_float_t {
+auto BRY::BernsteinBasisTransform<DIM>::pwrToBernCoeff(bry_int_t to_degree) {
+    return [to_degree] (const auto& i_midx, const auto& l_midx) -> bry_float_t {
         // Compute the transformation coefficient in a numerically stable way
         bry_float_t transformation_coeff = 1.0;
         for (bry_int_t j = 0; j < DIM; ++j) {
-            transformation_coeff *= static_cast<bry_float_t>(binom(i_midx[j], l_midx[j])) / static_cast<bry_float_t>(binom(to_degree, l_midx[j]));
+            transformation_coeff *= binomFloat(i_midx[j], l_midx[j]) * binomReciprocal(to_degree, l_midx[j]);
         }
         return transformation_coeff;
     };
-    return makeBigMatrix(to_degree, degree, makeCoeff);
 }
 
 template <std::size_t DIM>
-BRY::Matrix BRY::BernsteinBasisTransform<DIM>::bernToPwrMatrix(bry_int_t degree) {
-    auto makeCoeff = [&] (const auto& i_midx, const auto& l_midx) -> bry_float_t {
+auto BRY::BernsteinBasisTransform<DIM>::bernToPwrCoeff(bry_int_t degree) {
+    return [degree] (const auto& i_midx, const auto& l_midx) -> bry_float_t {
         bry_float_t transformation_coeff = 1.0;
 
         bool neg = false;
         for (bry_int_t j = 0; j < DIM; ++j) {
-            transformation_coeff *= static_cast<bry_float_t>(binom(degree - l_midx[j], degree - i_midx[j]) * binom(degree, l_midx[j]));
+            transformation_coeff *= binomFloat(degree - l_midx[j], degree - i_midx[j]) * binomFloat(degree, l_midx[j]);
             if ((i_midx[j] - l_midx[j]) % 2 != 0) 
                 neg = !neg;
         }
 
         return neg ? -transformation_coeff : transformation_coeff;
     };
-    return makeBigMatrix(degree, degree, makeCoeff);
 }
 
 template <std::size_t DIM>
-template <typename COEFF_LAM>
-BRY::Matrix BRY::BernsteinBasisTransform<DIM>::makeBigMatrix(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff) {
-    Matrix matrix(pow(to_degree + 1, DIM), pow(from_degree + 1, DIM));
-    matrix.setZero();
+BRY::Matrix BRY::BernsteinBasisTransform<DIM>::pwrToBernMatrix(bry_int_t degree, bry_int_t degree_increase) {
+    BRY_PROBE(PwrToBernMatrix, pow(degree + 1, DIM));
+    bry_int_t to_degree = degree + degree_increase;
+    Matrix matrix = makeBigMatrix(to_degree, degree, pwrToBernCoeff(to_degree));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(matrix));
+    return matrix;
+}
+
+template <std::size_t DIM>
+BRY::Matrix BRY::BernsteinBasisTransform<DIM>::bernToPwrMatrix(bry_int_t degree) {
+    BRY_PROBE(BernToPwrMatrix, pow(degree + 1, DIM));
+    Matrix matrix = makeBigMatrix(degree, degree, bernToPwrCoeff(degree));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(matrix));
+    return matrix;
+}
+
+template <std::size_t DIM>
+BRY::SparseMatrix BRY::BernsteinBasisTransform<DIM>::pwrToBernSparseMatrix(bry_int_t degree, bry_int_t degree_increase) {
+    BRY_PROBE(PwrToBernSparseMatrix, pow(degree + 1, DIM));
+    bry_int_t to_degree = degree + degree_increase;
+    SparseMatrix matrix = makeBigSparseMatrix(to_degree, degree, pwrToBernCoeff(to_degree));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(matrix));
+    return matrix;
+}
+
+template <std::size_t DIM>
+BRY::SparseMatrix BRY::BernsteinBasisTransform<DIM>::bernToPwrSparseMatrix(bry_int_t degree) {
+    BRY_PROBE(BernToPwrSparseMatrix, pow(degree + 1, DIM));
+    SparseMatrix matrix = makeBigSparseMatrix(degree, degree, bernToPwrCoeff(degree));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(matrix));
+    return matrix;
+}
+
+template <std::size_t DIM>
+BRY::KroneckerTransform<DIM> BRY::BernsteinBasisTransform<DIM>::pwrToBernTransform(bry_int_t degree, bry_int_t degree_increase) {
+    BRY_PROBE(PwrToBernTransform, pow(degree + 1, DIM));
+    // The transformation coefficients are separable across dimensions, so every factor is the 1-D transformation
+    KroneckerTransform<DIM> transform(BernsteinBasisTransform<1>::pwrToBernMatrix(degree, degree_increase));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(transform));
+    return transform;
+}
+
+template <std::size_t DIM>
+BRY::KroneckerTransform<DIM> BRY::BernsteinBasisTransform<DIM>::bernToPwrTransform(bry_int_t degree) {
+    BRY_PROBE(BernToPwrTransform, pow(degree + 1, DIM));
+    KroneckerTransform<DIM> transform(BernsteinBasisTransform<1>::bernToPwrMatrix(degree));
+    BRY_PROBE_BYTES(_BRY::operatorBytes(transform));
+    return transform;
+}
 
-    // In place multi index for 'l' indices
-    std::array<bry_int_t, DIM> l_idx;
-    std::array<bry_int_t, DIM> i_idx;
+template <std::size_t DIM>
+std::shared_ptr<const BRY::Matrix> BRY::BernsteinBasisTransform<DIM>::cachedPwrToBernMatrix(bry_int_t degree, bry_int_t degree_increase) {
+    OperatorKey key{OperatorType::PwrToBernMatrix, DIM, degree, degree_increase};
+    return OperatorCache::instance().fetch<Matrix>(key, [&] {
+        return pwrToBernMatrix(degree, degree_increase);
+    });
+}
+
+template <std::size_t DIM>
+std::shared_ptr<const BRY::Matrix> BRY::BernsteinBasisTransform<DIM>::cachedBernToPwrMatrix(bry_int_t degree) {
+    OperatorKey key{OperatorType::BernToPwrMatrix, DIM, degree, 0};
+    return OperatorCache::instance().fetch<Matrix>(key, [&] {
+        return bernToPwrMatrix(degree);
+    });
+}
 
-    MultiIndex<ExhaustiveIncrementerWrap> i_midx(i_idx.data(), DIM, true, to_degree + 1);
-    for (; !i_midx.last(); ++i_midx) {
+template <std::size_t DIM>
+std::shared_ptr<const BRY::SparseMatrix> BRY::BernsteinBasisTransform<DIM>::cachedPwrToBernSparseMatrix(bry_int_t degree, bry_int_t degree_increase) {
+    OperatorKey key{OperatorType::SparsePwrToBernMatrix, DIM, degree, degree_increase};
+    return OperatorCache::instance().fetch<SparseMatrix>(key, [&] {
+        return pwrToBernSparseMatrix(degree, degree_increase);
+    });
+}
+
+template <std::size_t DIM>
+std::shared_ptr<const BRY::SparseMatrix> BRY::BernsteinBasisTransform<DIM>::cachedBernToPwrSparseMatrix(bry_int_t degree) {
+    OperatorKey key{OperatorType::SparseBernToPwrMatrix, DIM, degree, 0};
+    return OperatorCache::instance().fetch<SparseMatrix>(key, [&] {
+        return bernToPwrSparseMatrix(degree);
+    });
+}
+
+template <std::size_t DIM>
+std::shared_ptr<const BRY::KroneckerTransform<DIM>> BRY::BernsteinBasisTransform<DIM>::cachedPwrToBernTransform(bry_int_t degree, bry_int_t degree_increase) {
+    OperatorKey key{OperatorType::PwrToBernTransform, DIM, degree, degree_increase};
+    return OperatorCache::instance().fetch<KroneckerTransform<DIM>>(key, [&] {
+        return pwrToBernTransform(degree, degree_increase);
+    });
+}
+
+template <std::size_t DIM>
+std::shared_ptr<const BRY::KroneckerTransform<DIM>> BRY::BernsteinBasisTransform<DIM>::cachedBernToPwrTransform(bry_int_t degree) {
+    OperatorKey key{OperatorType::BernToPwrTransform, DIM, degree, 0};
+    return OperatorCache::instance().fetch<KroneckerTransform<DIM>>(key, [&] {
+        return bernToPwrTransform(degree);
+    });
+}
+
+template <std::size_t DIM>
+template <typename COEFF_LAM, typename VISITOR>
+void BRY::BernsteinBasisTransform<DIM>::forEachBigMatrixEntry(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff, VISITOR visit) {
+    for (auto i_midx = smIdx<DIM>(to_degree + 1); !i_midx.last(); ++i_midx) {
         
         // Use the row midx as the bounds for the column (i) iterator
-        std::vector<bry_int_t> index_bounds;
-        index_bounds.reserve(DIM);
-        for (bry_int_t r_i : i_midx)
-            index_bounds.push_back(std::min(r_i + 1, from_degree + 1));
+        std::array<bry_int_t, DIM> index_bounds;
+        for (std::size_t d = 0; d < DIM; ++d)
+            index_bounds[d] = std::min(i_midx[d] + 1, from_degree + 1);
 
         // Create the column multi index
-        MultiIndex<BoundedExhaustiveIncrementerWrap> l_midx(l_idx.data(), DIM, true, index_bounds, from_degree + 1);
-        for (; !l_midx.last(); ++l_midx) {
-            matrix(i_midx.inc().wrappedIdx(), l_midx.inc().wrappedIdx()) = makeCoeff(i_midx, l_midx);
+        for (auto l_midx = smIdxB<DIM>(index_bounds, from_degree + 1); !l_midx.last(); ++l_midx) {
+            visit(i_midx.wrappedIdx(), l_midx.wrappedIdx(), makeCoeff(i_midx, l_midx));
         }
     }
+}
+
+template <std::size_t DIM>
+template <typename COEFF_LAM>
+BRY::Matrix BRY::BernsteinBasisTransform<DIM>::makeBigMatrix(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff) {
+    Matrix matrix(pow(to_degree + 1, DIM), pow(from_degree + 1, DIM));
+    matrix.setZero();
+    forEachBigMatrixEntry(to_degree, from_degree, makeCoeff, [&matrix] (bry_int_t row, bry_int_t col, bry_float_t value) {
+        matrix(row, col) = value;
+    });
+    return matrix;
+}
+
+template <std::size_t DIM>
+template <typename COEFF_LAM>
+BRY::SparseMatrix BRY::BernsteinBasisTransform<DIM>::makeBigSparseMatrix(bry_int_t to_degree, bry_int_t from_degree, COEFF_LAM makeCoeff) {
+    std::vector<Eigen::Triplet<bry_float_t>> triplets;
+    forEachBigMatrixEntry(to_degree, from_degree, makeCoeff, [&triplets] (bry_int_t row, bry_int_t col, bry_float_t value) {
+        triplets.emplace_back(row, col, value);
+    });
+
+    SparseMatrix matrix(pow(to_degree + 1, DIM), pow(from_degree + 1, DIM));
+    matrix.setFromTriplets(triplets.begin(), triplets.end());
     return matrix;
 }
 
 template <std::size_t DIM>
 std::pair<BRY::bry_float_t, bool> BRY::BernsteinBasisTransform<DIM>::infBound(const BRY::Polynomial<DIM, BRY::Basis::Bernstein>& p) {
+    BRY_PROBE(InfBound, p.nMonomials());
     Eigen::Tensor<bry_float_t, 0> min = p.tensor().minimum();
 
     bry_float_t min_coeff = min();
-    Eigen::Vector<bry_int_t, DIM> vertex_idx = Eigen::Vector<bry_int_t, DIM>::Zero();
-    MultiIndex<ExhaustiveIncrementer> midx(vertex_idx.data(), DIM, true, 2);
-    for (; !midx.last(); ++midx) {
-        bry_float_t vertex_val = p.tensor()(p.degree() * vertex_idx);
+
+    // Offset of the far vertex along each dimension
+    std::array<bry_int_t, DIM> vertex_strides;
+    for (std::size_t d = 0; d < DIM; ++d)
+        vertex_strides[d] = p.degree() * pow(p.degree() + 1, d);
+
+    for (auto midx = smIdx<DIM>(2); !midx.last(); ++midx) {
+        bry_int_t vertex_offset = 0;
+        for (std::size_t d = 0; d < DIM; ++d)
+            vertex_offset += midx[d] * vertex_strides[d];
+        bry_float_t vertex_val = p.tensor().data()[vertex_offset];
         if (vertex_val == min_coeff) {
             return std::make_pair(min_coeff, true);
         }
@@ -90,16 +218,15 @@ std::pair<BRY::bry_float_t, bool> BRY::BernsteinBasisTransform<DIM>::infBound(co
 
 template <std::size_t DIM>
 std::pair<BRY::bry_float_t, bool> BRY::BernsteinBasisTransform<DIM>::infBound(const BRY::Polynomial<DIM, BRY::Basis::Bernstein>& p, std::array<bry_int_t, DIM>& coefficient_idx) {
+    BRY_PROBE(InfBound, p.nMonomials());
     bry_float_t min_coeff = std::numeric_limits<bry_float_t>::max();
 
     bool is_vertex = false;
-    std::array<bry_int_t, DIM> idx;
-    MultiIndex<ExhaustiveIncrementer> midx(idx.data(), DIM, true, p.degree() + 1);
-    for (; !midx.last(); ++midx) {
-        bry_float_t coeff = p.coeff(idx);
+    for (const auto& midx : smIdxRange<DIM>(p.degree() + 1)) {
+        bry_float_t coeff = p.tensor().data()[midx.wrappedIdx()];
         if (coeff < min_coeff) {
             min_coeff = coeff;
-            coefficient_idx = idx;
+            coefficient_idx = midx.idx();
 
             is_vertex = true;
             for (auto i : midx) {
@@ -114,31 +241,111 @@ std::pair<BRY::bry_float_t, bool> BRY::BernsteinBasisTransform<DIM>::infBound(co
     return std::make_pair(min_coeff, is_vertex);
 }
 
+template <std::size_t DIM>
+std::pair<BRY::bry_float_t, bool> BRY::BernsteinBasisTransform<DIM>::infBound(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const std::array<bry_float_t, DIM>& lower, 
+        const std::array<bry_float_t, DIM>& upper, BoundWorkspace& workspace, bry_int_t degree_increase) {
+    BRY_PROBE(InfBound, p.nMonomials());
+    std::array<bry_float_t, DIM> scale;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        BRY_ASSERT(lower[d] <= upper[d], "Lower corner of the box exceeds the upper corner");
+        scale[d] = upper[d] - lower[d];
+    }
+
+    // Reparameterize a copy in the workspace, so that re-bounding many boxes does not allocate
+    workspace.m_reparameterized.assign(p.tensor().data(), p.tensor().data() + p.nMonomials());
+    _BRY::reparameterizeCoefficients<DIM>(workspace.m_reparameterized.data(), p.degree() + 1, lower, scale);
+    BernsteinBound<DIM> result = bound(workspace.m_reparameterized.data(), p.degree(), workspace, degree_increase);
+    return std::make_pair(result.lower_bound, result.vertex_condition);
+}
+
 template <std::size_t DIM>
 BRY::bry_float_t BRY::BernsteinBasisTransform<DIM>::infBoundGap(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, bool vertex_condition, bry_int_t degree_increase) {
+    BRY_PROBE(InfBoundGap, p.nMonomials());
+    return infBoundGap(p.tensor().data(), p.degree(), vertex_condition, degree_increase);
+}
+
+template <std::size_t DIM>
+BRY::BernsteinBound<DIM> BRY::BernsteinBasisTransform<DIM>::bound(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, BoundWorkspace& workspace, bry_int_t degree_increase) {
+    BRY_PROBE(Bound, p.nMonomials());
+    return bound(p.tensor().data(), p.degree(), workspace, degree_increase);
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::BernsteinBasisTransform<DIM>::infBoundGap(const bry_float_t* coeffs, bry_int_t degree, bool vertex_condition, bry_int_t degree_increase) {
     if (vertex_condition)
         return 0.0;
 
     bry_float_t epsilon = 0.0;
-    std::array<bry_int_t, DIM> idx;
-    MultiIndex<ExhaustiveIncrementer> midx(idx.data(), DIM, true, p.degree() + 1);
-    for (; !midx.last(); ++midx) {
+    for (const auto& midx : smIdxRange<DIM>(degree + 1)) {
         bry_int_t multiplier = 0;
-        for (bry_int_t d = 0; d < DIM; ++d) {
+        for (std::size_t d = 0; d < DIM; ++d) {
             if (midx[d] != 0) {
                 multiplier += (midx[d] - 1) * (midx[d] - 1);
             }
         }
-        //DEBUG("midx: " << midx << " adding " << static_cast<bry_float_t>(multiplier) * std::abs(p.coeff(idx)) << " from coeff: " << (p.coeff(idx)));
-        epsilon += static_cast<bry_float_t>(multiplier) * std::abs(p.coeff(idx));
+        epsilon += static_cast<bry_float_t>(multiplier) * std::abs(coeffs[midx.wrappedIdx()]);
     }
-    //DEBUG("epsilon: " << epsilon << " degree: " << p.degree());
-    //PAUSE;
 
-    bry_float_t raised_deg_f = static_cast<bry_float_t>(p.degree() + degree_increase);
+    bry_float_t raised_deg_f = static_cast<bry_float_t>(degree + degree_increase);
     return epsilon * (raised_deg_f - 1.0) / (raised_deg_f * raised_deg_f);
 }
 
+template <std::size_t DIM>
+BRY::BernsteinBound<DIM> BRY::BernsteinBasisTransform<DIM>::bound(const bry_float_t* coeffs, bry_int_t degree, BoundWorkspace& workspace, bry_int_t degree_increase) {
+    bry_int_t n_in = degree + 1;
+    bry_int_t n_out = n_in + degree_increase;
+
+    if (workspace.m_degree != degree || workspace.m_degree_increase != degree_increase) {
+        workspace.m_factor = BernsteinBasisTransform<1>::cachedPwrToBernMatrix(degree, degree_increase);
+        workspace.m_degree = degree;
+        workspace.m_degree_increase = degree_increase;
+    }
+    const Matrix& factor = *workspace.m_factor;
+    workspace.reserve(pow(n_out, DIM));
+
+    // Apply all but the last mode, ping-ponging between the workspace buffers
+    std::array<bry_int_t, DIM> dims = makeUniformArray<bry_int_t, DIM>(n_in);
+    const bry_float_t* src = coeffs;
+    bry_float_t* dst = workspace.m_buffer_a.data();
+    bry_float_t* spare = workspace.m_buffer_b.data();
+    for (std::size_t d = 0; d + 1 < DIM; ++d) {
+        modeProduct<DIM>(src, dst, dims, d, factor);
+        dims[d] = n_out;
+        src = dst;
+        std::swap(dst, spare);
+    }
+
+    // Apply the last mode one output slab at a time, and reduce each slab while it is in cache
+    BernsteinBound<DIM> result;
+    result.lower_bound = std::numeric_limits<bry_float_t>::max();
+    bry_int_t min_offset = 0;
+
+    bry_int_t left = pow(n_out, DIM - 1);
+    Eigen::Map<const Matrix> src_slab(src, left, n_in);
+    Eigen::Map<Vector> dst_slab(dst, left);
+    for (bry_int_t i = 0; i < n_out; ++i) {
+        dst_slab.noalias() = src_slab * factor.row(i).transpose();
+        for (bry_int_t k = 0; k < left; ++k) {
+            if (dst[k] < result.lower_bound) {
+                result.lower_bound = dst[k];
+                min_offset = k + i * left;
+            }
+        }
+    }
+
+    bry_int_t bern_degree = n_out - 1;
+    result.vertex_condition = true;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        result.coefficient_idx[d] = min_offset % n_out;
+        min_offset /= n_out;
+        if (result.coefficient_idx[d] != 0 && result.coefficient_idx[d] != bern_degree)
+            result.vertex_condition = false;
+    }
+
+    result.gap = infBoundGap(coeffs, degree, result.vertex_condition, degree_increase);
+    return result;
+}
+
 template <std::size_t DIM>
 Eigen::Vector<BRY::bry_float_t, DIM> BRY::BernsteinBasisTransform<DIM>::ctrlPtOnUnitBox(const std::array<bry_int_t, DIM>& coefficient_idx, bry_int_t bernstein_p_deg) {
     Eigen::Vector<bry_float_t, DIM> ctrl_point;
@@ -146,4 +353,41 @@ Eigen::Vector<BRY::bry_float_t, DIM> BRY::BernsteinBasisTransform<DIM>::ctrlPtOn
         ctrl_point[d] = static_cast<bry_float_t>(coefficient_idx[d]) / bernstein_p_deg;
     }
     return ctrl_point;
-}
\ No newline at end of file
+}
+
+template <std::size_t DIM>
+std::pair<BRY::Polynomial<DIM, BRY::Basis::Bernstein>, BRY::Polynomial<DIM, BRY::Basis::Bernstein>> BRY::BernsteinBasisTransform<DIM>::subdivide(const BRY::Polynomial<DIM, BRY::Basis::Bernstein>& p, std::size_t dim, bry_float_t t) {
+    BRY_ASSERT(dim < DIM, "Subdivision dimension out of bounds");
+    BRY_PROBE(Subdivide, p.nMonomials());
+    bry_int_t n = p.degree() + 1;
+    bry_int_t stride = pow(n, dim);
+    bry_int_t n_outer = p.nMonomials() / (stride * n);
+
+    Eigen::Tensor<bry_float_t, DIM> lower_tensor(p.tensor().dimensions());
+    Eigen::Tensor<bry_float_t, DIM> upper_tensor(p.tensor().dimensions());
+    BRY_PROBE_BYTES(2 * p.nMonomials() * sizeof(bry_float_t));
+
+    const bry_float_t* src = p.tensor().data();
+    bry_float_t* lower = lower_tensor.data();
+    bry_float_t* upper = upper_tensor.data();
+
+    bry_float_t one_minus_t = 1.0 - t;
+    std::vector<bry_float_t> b(n);
+    for (bry_int_t outer = 0; outer < n_outer; ++outer) {
+        for (bry_int_t inner = 0; inner < stride; ++inner) {
+            bry_int_t base = outer * stride * n + inner;
+            for (bry_int_t k = 0; k < n; ++k)
+                b[k] = src[base + k * stride];
+
+            // The first and last points of each de Casteljau level are the coefficients of the two halves
+            for (bry_int_t r = 0; r < n; ++r) {
+                lower[base + r * stride] = b[0];
+                upper[base + (n - 1 - r) * stride] = b[n - 1 - r];
+                for (bry_int_t i = 0; i < n - 1 - r; ++i)
+                    b[i] = one_minus_t * b[i] + t * b[i + 1];
+            }
+        }
+    }
+
+    return std::make_pair(Polynomial<DIM, Basis::Bernstein>(std::move(lower_tensor)), Polynomial<DIM, Basis::Bernstein>(std::move(upper_tensor)));
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "BranchAndBound.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <limits>
+
+template <std::size_t DIM>
+BRY::BranchAndBoundMinimizer<DIM>::BranchAndBoundMinimizer(bry_float_t tolerance, std::size_t max_boxes, std::size_t batch_size, TaskScheduler* scheduler)
+    : m_tolerance(tolerance)
+    , m_max_boxes(max_boxes)
+    , m_batch_size(std::max<std::size_t>(batch_size, 1))
+    , m_scheduler(scheduler)
+{}
+
+template <std::size_t DIM>
+typename BRY::BranchAndBoundMinimizer<DIM>::Result BRY::BranchAndBoundMinimizer<DIM>::minimize(const Polynomial<DIM, Basis::Power>& p, bry_int_t degree_increase) const {
+    auto tf = BernsteinBasisTransform<DIM>::cachedPwrToBernTransform(p.degree(), degree_increase);
+    return minimize(transform<DIM, Basis::Power, Basis::Bernstein>(p, *tf));
+}
+
+template <std::size_t DIM>
+typename BRY::BranchAndBoundMinimizer<DIM>::Result BRY::BranchAndBoundMinimizer<DIM>::minimize(const Polynomial<DIM, Basis::Bernstein>& p) const {
+    Result result;
+    result.upper_bound = std::numeric_limits<bry_float_t>::max();
+    result.minimizer.setZero();
+    Statistics& stats = result.statistics;
+
+    BoxCompare compare;
+    std::vector<Box> queue;
+
+    // Update the best upper bound with a bounded box, and queue the box if it may still contain a smaller value
+    auto process = [&] (Box&& box, const BoxBound& box_bound) {
+        ++stats.visited;
+        stats.max_depth = std::max(stats.max_depth, box.depth);
+
+        box.lower_bound = box_bound.lower_bound;
+        if (box_bound.candidate_value < result.upper_bound) {
+            result.upper_bound = box_bound.candidate_value;
+            result.minimizer = box_bound.candidate;
+        }
+
+        if (box_bound.vertex_condition) {
+            // The smallest coefficient is the minimum on the box, which was already used as a candidate
+            ++stats.resolved;
+            return;
+        }
+
+        if (box.lower_bound >= result.upper_bound) {
+            ++stats.pruned;
+            return;
+        }
+
+        queue.push_back(std::move(box));
+        std::push_heap(queue.begin(), queue.end(), compare);
+        stats.max_queue_size = std::max(stats.max_queue_size, queue.size());
+    };
+
+    Box root{p, makeUniformArray<bry_float_t, DIM>(0.0), makeUniformArray<bry_float_t, DIM>(1.0), 0.0, 0};
+    BoxBound root_bound = bound(root);
+    process(std::move(root), root_bound);
+
+    std::vector<Box> batch;
+    batch.reserve(m_batch_size);
+    while (!queue.empty()) {
+        // Take the boxes with the smallest lower bounds
+        batch.clear();
+        while (!queue.empty() && batch.size() < m_batch_size) {
+            if (result.upper_bound - queue.front().lower_bound <= m_tolerance || stats.visited + 2 * batch.size() >= m_max_boxes)
+                break;
+
+            std::pop_heap(queue.begin(), queue.end(), compare);
+            Box box = std::move(queue.back());
+            queue.pop_back();
+
+            // Boxes queued before the upper bound improved
+            if (box.lower_bound >= result.upper_bound) {
+                ++stats.pruned;
+                continue;
+            }
+            batch.push_back(std::move(box));
+        }
+
+        if (batch.empty())
+            break;
+
+        // Splitting and bounding is independent for each box, the results are processed in batch order
+        std::vector<Split> splits;
+        if (m_scheduler) {
+            splits = m_scheduler->template parallelMap<Split>(batch.size(), [&] (bry_int_t i) {
+                return split(batch[i]);
+            });
+        } else {
+            splits.reserve(batch.size());
+            for (const Box& box : batch)
+                splits.push_back(split(box));
+        }
+
+        stats.subdivided += batch.size();
+        for (Split& box_split : splits) {
+            process(std::move(box_split.boxes[0]), box_split.bounds[0]);
+            process(std::move(box_split.boxes[1]), box_split.bounds[1]);
+        }
+    }
+
+    result.lower_bound = queue.empty() ? result.upper_bound : std::min(queue.front().lower_bound, result.upper_bound);
+    result.converged = result.upper_bound - result.lower_bound <= m_tolerance;
+    return result;
+}
+
+template <std::size_t DIM>
+typename BRY::BranchAndBoundMinimizer<DIM>::BoxBound BRY::BranchAndBoundMinimizer<DIM>::bound(const Box& box) {
+    BoxBound box_bound;
+
+    std::array<bry_int_t, DIM> min_coeff_idx;
+    std::tie(box_bound.lower_bound, box_bound.vertex_condition) = BernsteinBasisTransform<DIM>::infBound(box.p, min_coeff_idx);
+
+    // Evaluate at the control point of the smallest coefficient to get an upper bound (a constant polynomial has a single control
+    // point, which is placed at the center of the box)
+    Eigen::Vector<bry_float_t, DIM> local_pt;
+    if (box.p.degree() == 0)
+        local_pt.setConstant(0.5);
+    else
+        local_pt = BernsteinBasisTransform<DIM>::ctrlPtOnUnitBox(min_coeff_idx, box.p.degree());
+    box_bound.candidate_value = box.p(local_pt);
+    for (std::size_t d = 0; d < DIM; ++d)
+        box_bound.candidate[d] = box.lower[d] + box.width[d] * local_pt[d];
+
+    return box_bound;
+}
+
+template <std::size_t DIM>
+typename BRY::BranchAndBoundMinimizer<DIM>::Split BRY::BranchAndBoundMinimizer<DIM>::split(const Box& box) {
+    // Split the widest side in half
+    std::size_t split_dim = std::distance(box.width.begin(), std::max_element(box.width.begin(), box.width.end()));
+    auto [lower_p, upper_p] = BernsteinBasisTransform<DIM>::subdivide(box.p, split_dim);
+
+    Box lower_box{std::move(lower_p), box.lower, box.width, 0.0, box.depth + 1};
+    lower_box.width[split_dim] *= 0.5;
+
+    Box upper_box{std::move(upper_p), box.lower, box.width, 0.0, box.depth + 1};
+    upper_box.width[split_dim] *= 0.5;
+    upper_box.lower[split_dim] += upper_box.width[split_dim];
+
+    BoxBound lower_bound = bound(lower_box);
+    BoxBound upper_bound = bound(upper_box);
+    return Split{{std::move(lower_box), std::move(upper_box)}, {lower_bound, upper_bound}};
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "DegreeChangeTransform.h"
+#include "MultiIndex.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+
+template <std::size_t DIM>
+BRY::DegreeChangeTransform<DIM>::DegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg)
+    : m_from_deg(from_deg)
+    , m_to_deg(to_deg)
+{}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::DegreeChangeTransform<DIM>::fromDegree() const {
+    return m_from_deg;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::DegreeChangeTransform<DIM>::toDegree() const {
+    return m_to_deg;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::DegreeChangeTransform<DIM>::apply(const Eigen::Tensor<bry_float_t, DIM>& tensor) const {
+#ifdef BRY_ENABLE_BOUNDS_CHECK
+    for (std::size_t d = 0; d < DIM; ++d)
+        ASSERT(tensor.dimension(d) == m_from_deg + 1, "Tensor dimensions do not match the degree change");
+#endif
+    std::array<bry_int_t, DIM> dims;
+    dims.fill(m_to_deg + 1);
+    Eigen::Tensor<bry_float_t, DIM> result(dims);
+    result.setZero();
+
+    // Walk the first term of each run with the source and destination wrapping in lockstep
+    bry_int_t run_length = std::min(m_from_deg, m_to_deg) + 1;
+    std::array<bry_int_t, DIM> run_bounds;
+    run_bounds.fill(run_length);
+    run_bounds[0] = 1;
+    auto src_midx = smIdxB<DIM>(run_bounds, m_from_deg + 1);
+    auto dst_midx = smIdxB<DIM>(run_bounds, m_to_deg + 1);
+    for (; !src_midx.last(); ++src_midx, ++dst_midx)
+        std::copy_n(tensor.data() + src_midx.wrappedIdx(), run_length, result.data() + dst_midx.wrappedIdx());
+    return result;
+}
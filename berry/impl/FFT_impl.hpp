@@ -0,0 +1,344 @@
+#pragma once
+
+#include "FFT.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace _BRY {
+
+/// @brief Copy the leading block of size `extents` between two (column-major) tensors of different dimensions
+template <std::size_t DIM>
+void copyLeadingBlock(const BRY::bry_float_t* src, const std::array<BRY::bry_int_t, DIM>& src_dims, BRY::bry_float_t* dst, const std::array<BRY::bry_int_t, DIM>& dst_dims, const std::array<BRY::bry_int_t, DIM>& extents) {
+    // Index along dimensions 1, ..., DIM - 1 (dimension 0 is copied contiguously)
+    std::array<BRY::bry_int_t, DIM> idx{};
+    while (true) {
+        BRY::bry_int_t src_offset = 0;
+        BRY::bry_int_t dst_offset = 0;
+        BRY::bry_int_t src_stride = src_dims[0];
+        BRY::bry_int_t dst_stride = dst_dims[0];
+        for (std::size_t d = 1; d < DIM; ++d) {
+            src_offset += idx[d] * src_stride;
+            dst_offset += idx[d] * dst_stride;
+            src_stride *= src_dims[d];
+            dst_stride *= dst_dims[d];
+        }
+        std::copy_n(src + src_offset, extents[0], dst + dst_offset);
+
+        std::size_t d = 1;
+        for (; d < DIM; ++d) {
+            if (++idx[d] < extents[d])
+                break;
+            idx[d] = 0;
+        }
+        if (d == DIM)
+            return;
+    }
+}
+
+/// @brief Dimensions of the power of a coefficient tensor
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> powerDims(const std::array<BRY::bry_int_t, DIM>& dims, BRY::bry_int_t exp) {
+    std::array<BRY::bry_int_t, DIM> power_dims;
+    for (std::size_t d = 0; d < DIM; ++d)
+        power_dims[d] = exp * (dims[d] - 1) + 1;
+    return power_dims;
+}
+
+/// @brief FFT shape that fits a tensor of dimensions `dims` without wrap-around
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> fftShape(const std::array<BRY::bry_int_t, DIM>& dims) {
+    std::array<BRY::bry_int_t, DIM> shape;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        // The real-input FFT along dimension 0 is fastest for multiples of 4
+        shape[d] = BRY::fftFriendlySize(dims[d], d == 0);
+    }
+    return shape;
+}
+
+/// @brief Integer power of a complex number by squaring
+BRY_INL BRY::bry_complex_t integerPower(BRY::bry_complex_t c, BRY::bry_int_t exp) {
+    BRY::bry_complex_t result(1.0, 0.0);
+    while (exp > 0) {
+        if (exp & 1)
+            result *= c;
+        exp >>= 1;
+        if (exp > 0)
+            c *= c;
+    }
+    return result;
+}
+
+}
+
+BRY::bry_int_t BRY::fftFriendlySize(bry_int_t n, bool multiple_of_4) {
+    for (bry_int_t m = std::max<bry_int_t>(n, 1); ; ++m) {
+        if (multiple_of_4 && m % 4 != 0)
+            continue;
+
+        bry_int_t r = m;
+        for (bry_int_t factor : {2, 3, 5}) {
+            while (r % factor == 0)
+                r /= factor;
+        }
+        if (r == 1)
+            return m;
+    }
+}
+
+template <std::size_t DIM>
+BRY::RealFFT<DIM>::RealFFT(const std::array<bry_int_t, DIM>& shape)
+    : m_shape(shape)
+    , m_spectrum_shape(shape)
+{
+    m_spectrum_shape[0] = m_shape[0] / 2 + 1;
+    m_fft.SetFlag(Eigen::FFT<bry_float_t>::HalfSpectrum);
+
+    bry_int_t max_fiber = *std::max_element(m_shape.begin(), m_shape.end());
+    m_fiber_in.resize(max_fiber);
+    m_fiber_out.resize(max_fiber);
+}
+
+template <std::size_t DIM>
+const std::array<BRY::bry_int_t, DIM>& BRY::RealFFT<DIM>::shape() const {
+    return m_shape;
+}
+
+template <std::size_t DIM>
+const std::array<BRY::bry_int_t, DIM>& BRY::RealFFT<DIM>::spectrumShape() const {
+    return m_spectrum_shape;
+}
+
+template <std::size_t DIM>
+void BRY::RealFFT<DIM>::forward(const bry_float_t* real, bry_complex_t* spectrum) {
+    bry_int_t n_0 = m_shape[0];
+    bry_int_t h_0 = m_spectrum_shape[0];
+    bry_int_t n_fibers = 1;
+    for (std::size_t d = 1; d < DIM; ++d)
+        n_fibers *= m_shape[d];
+
+    // Dimension 0 fibers are contiguous
+    for (bry_int_t f = 0; f < n_fibers; ++f)
+        m_fft.fwd(spectrum + f * h_0, real + f * n_0, n_0);
+
+    complexPass(spectrum, false);
+}
+
+template <std::size_t DIM>
+void BRY::RealFFT<DIM>::inverse(bry_complex_t* spectrum, bry_float_t* real) {
+    complexPass(spectrum, true);
+
+    bry_int_t n_0 = m_shape[0];
+    bry_int_t h_0 = m_spectrum_shape[0];
+    bry_int_t n_fibers = 1;
+    for (std::size_t d = 1; d < DIM; ++d)
+        n_fibers *= m_shape[d];
+
+    for (bry_int_t f = 0; f < n_fibers; ++f)
+        m_fft.inv(real + f * n_0, spectrum + f * h_0, n_0);
+}
+
+template <std::size_t DIM>
+BRY::RealFFT<DIM>& BRY::RealFFT<DIM>::plan(const std::array<bry_int_t, DIM>& shape) {
+    PlanCache& cache = planCache();
+    auto it = cache.plans.find(shape);
+    if (it != cache.plans.end()) {
+        cache.lru.splice(cache.lru.begin(), cache.lru, it->second);
+        return *cache.lru.front();
+    }
+
+    // Evict the least recently used plans
+    while (cache.lru.size() >= BRY_FFT_PLAN_CACHE_SIZE) {
+        cache.plans.erase(cache.lru.back()->shape());
+        cache.lru.pop_back();
+    }
+
+    cache.lru.push_front(std::make_unique<RealFFT<DIM>>(shape));
+    cache.plans[shape] = cache.lru.begin();
+    return *cache.lru.front();
+}
+
+template <std::size_t DIM>
+void BRY::RealFFT<DIM>::clearPlans() {
+    PlanCache& cache = planCache();
+    cache.plans.clear();
+    cache.lru.clear();
+}
+
+template <std::size_t DIM>
+typename BRY::RealFFT<DIM>::PlanCache& BRY::RealFFT<DIM>::planCache() {
+    thread_local PlanCache cache;
+    return cache;
+}
+
+template <std::size_t DIM>
+void BRY::RealFFT<DIM>::complexPass(bry_complex_t* spectrum, bool inverse) {
+    bry_int_t size = 1;
+    for (bry_int_t s : m_spectrum_shape)
+        size *= s;
+
+    bry_int_t stride = m_spectrum_shape[0];
+    for (std::size_t d = 1; d < DIM; ++d) {
+        bry_int_t n = m_spectrum_shape[d];
+
+        // The FFT of a single element is the identity (and not supported by kissfft)
+        if (n == 1)
+            continue;
+
+        bry_int_t n_outer = size / (stride * n);
+        for (bry_int_t outer = 0; outer < n_outer; ++outer) {
+            for (bry_int_t inner = 0; inner < stride; ++inner) {
+                bry_complex_t* fiber = spectrum + outer * stride * n + inner;
+                for (bry_int_t k = 0; k < n; ++k)
+                    m_fiber_in[k] = fiber[k * stride];
+
+                if (inverse) {
+                    m_fft.inv(m_fiber_out.data(), m_fiber_in.data(), n);
+                } else {
+                    m_fft.fwd(m_fiber_out.data(), m_fiber_in.data(), n);
+                }
+
+                for (bry_int_t k = 0; k < n; ++k)
+                    fiber[k * stride] = m_fiber_out[k];
+            }
+        }
+        stride *= n;
+    }
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::fftMultiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    BRY_PROBE(FFTMultiply, a.size() + b.size());
+    std::array<bry_int_t, DIM> a_dims = a.dimensions();
+    std::array<bry_int_t, DIM> b_dims = b.dimensions();
+    std::array<bry_int_t, DIM> result_dims;
+    for (std::size_t d = 0; d < DIM; ++d)
+        result_dims[d] = a_dims[d] + b_dims[d] - 1;
+    std::array<bry_int_t, DIM> fft_shape = _BRY::fftShape<DIM>(result_dims);
+
+    RealFFT<DIM>& plan = RealFFT<DIM>::plan(fft_shape);
+
+    bry_int_t real_size = 1;
+    bry_int_t spectrum_size = 1;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        real_size *= fft_shape[d];
+        spectrum_size *= plan.spectrumShape()[d];
+    }
+
+    ScopedArena scope;
+    bry_float_t* real = scope.arena().allocate<bry_float_t>(real_size);
+    bry_complex_t* a_spectrum = scope.arena().allocate<bry_complex_t>(spectrum_size);
+    std::fill_n(real, real_size, 0.0);
+    _BRY::copyLeadingBlock<DIM>(a.data(), a_dims, real, fft_shape, a_dims);
+    plan.forward(real, a_spectrum);
+
+    if (&a == &b) {
+        // Squaring only needs one forward transform
+        for (bry_int_t i = 0; i < spectrum_size; ++i)
+            a_spectrum[i] *= a_spectrum[i];
+    } else {
+        bry_complex_t* b_spectrum = scope.arena().allocate<bry_complex_t>(spectrum_size);
+        std::fill_n(real, real_size, 0.0);
+        _BRY::copyLeadingBlock<DIM>(b.data(), b_dims, real, fft_shape, b_dims);
+        plan.forward(real, b_spectrum);
+
+        for (bry_int_t i = 0; i < spectrum_size; ++i)
+            a_spectrum[i] *= b_spectrum[i];
+    }
+
+    plan.inverse(a_spectrum, real);
+
+    Eigen::Tensor<bry_float_t, DIM> result(result_dims);
+    BRY_PROBE_BYTES(result.size() * sizeof(bry_float_t));
+    _BRY::copyLeadingBlock<DIM>(real, fft_shape, result.data(), result_dims, result_dims);
+    return result;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::fftPower(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp) {
+    BRY_ASSERT(exp > 0, "Exponent must be positive");
+    BRY_PROBE(FFTPower, a.size());
+    std::array<bry_int_t, DIM> a_dims = a.dimensions();
+    std::array<bry_int_t, DIM> result_dims = _BRY::powerDims<DIM>(a_dims, exp);
+    std::array<bry_int_t, DIM> fft_shape = _BRY::fftShape<DIM>(result_dims);
+
+    RealFFT<DIM>& plan = RealFFT<DIM>::plan(fft_shape);
+
+    bry_int_t real_size = 1;
+    bry_int_t spectrum_size = 1;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        real_size *= fft_shape[d];
+        spectrum_size *= plan.spectrumShape()[d];
+    }
+
+    ScopedArena scope;
+    bry_float_t* real = scope.arena().allocate<bry_float_t>(real_size);
+    bry_complex_t* spectrum = scope.arena().allocate<bry_complex_t>(spectrum_size);
+    std::fill_n(real, real_size, 0.0);
+    _BRY::copyLeadingBlock<DIM>(a.data(), a_dims, real, fft_shape, a_dims);
+    plan.forward(real, spectrum);
+
+    for (bry_int_t i = 0; i < spectrum_size; ++i)
+        spectrum[i] = _BRY::integerPower(spectrum[i], exp);
+
+    plan.inverse(spectrum, real);
+
+    Eigen::Tensor<bry_float_t, DIM> result(result_dims);
+    BRY_PROBE_BYTES(result.size() * sizeof(bry_float_t));
+    _BRY::copyLeadingBlock<DIM>(real, fft_shape, result.data(), result_dims, result_dims);
+    return result;
+}
+
+template <std::size_t DIM>
+std::vector<Eigen::Tensor<BRY::bry_float_t, DIM>> BRY::fftPowers(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t max_exp) {
+    BRY_PROBE(FFTPowers, a.size());
+    std::array<bry_int_t, DIM> a_dims = a.dimensions();
+    std::array<bry_int_t, DIM> fft_shape = _BRY::fftShape<DIM>(_BRY::powerDims<DIM>(a_dims, max_exp));
+
+    RealFFT<DIM>& plan = RealFFT<DIM>::plan(fft_shape);
+
+    bry_int_t real_size = 1;
+    bry_int_t spectrum_size = 1;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        real_size *= fft_shape[d];
+        spectrum_size *= plan.spectrumShape()[d];
+    }
+
+    std::vector<Eigen::Tensor<bry_float_t, DIM>> result;
+    result.reserve(max_exp + 1);
+    result.emplace_back(_BRY::powerDims<DIM>(a_dims, 0));
+    result.back().setConstant(1.0);
+    if (max_exp == 0)
+        return result;
+    result.push_back(a);
+
+    // Spectrum of `a`, and the running power spectrum
+    ScopedArena scope;
+    bry_float_t* real = scope.arena().allocate<bry_float_t>(real_size);
+    bry_complex_t* a_spectrum = scope.arena().allocate<bry_complex_t>(spectrum_size);
+    std::fill_n(real, real_size, 0.0);
+    _BRY::copyLeadingBlock<DIM>(a.data(), a_dims, real, fft_shape, a_dims);
+    plan.forward(real, a_spectrum);
+
+    bry_complex_t* power_spectrum = scope.arena().allocate<bry_complex_t>(spectrum_size);
+    bry_complex_t* scratch = scope.arena().allocate<bry_complex_t>(spectrum_size);
+    std::copy_n(a_spectrum, spectrum_size, power_spectrum);
+    for (bry_int_t exp = 2; exp <= max_exp; ++exp) {
+        for (bry_int_t i = 0; i < spectrum_size; ++i)
+            power_spectrum[i] *= a_spectrum[i];
+
+        // The inverse transform overwrites the spectrum
+        std::copy_n(power_spectrum, spectrum_size, scratch);
+        plan.inverse(scratch, real);
+
+        std::array<bry_int_t, DIM> power_dims = _BRY::powerDims<DIM>(a_dims, exp);
+        result.emplace_back(power_dims);
+        _BRY::copyLeadingBlock<DIM>(real, fft_shape, result.back().data(), power_dims, power_dims);
+    }
+    BRY_PROBE_BYTES(std::accumulate(result.begin(), result.end(), std::size_t(0), [] (std::size_t bytes, const Eigen::Tensor<bry_float_t, DIM>& power) {
+        return bytes + power.size() * sizeof(bry_float_t);
+    }));
+    return result;
+}
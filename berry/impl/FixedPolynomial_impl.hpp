@@ -0,0 +1,194 @@
+#pragma once
+
+#include "FixedPolynomial.h"
+#include "Operations.h"
+
+#include "lemon/Logging.h"
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG>::FixedPolynomial()
+    : m_coeffs{}
+{}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG>::FixedPolynomial(const std::array<bry_float_t, s_size>& coefficients)
+    : m_coeffs(coefficients)
+{}
+
+template <std::size_t DIM, std::size_t DEG>
+BRY::FixedPolynomial<DIM, DEG>::FixedPolynomial(const Polynomial<DIM, Basis::Power>& p)
+    : m_coeffs{}
+{
+    BRY_ASSERT(p.degree() <= degree(), "Polynomial degree exceeds the fixed degree");
+
+    std::array<bry_int_t, DIM> idx{};
+    for (bry_int_t i = 0; i < p.nMonomials(); ++i) {
+        coeff(idx) = p.tensor().data()[i];
+        for (std::size_t d = 0; d < DIM; ++d) {
+            if (++idx[d] <= p.degree())
+                break;
+            idx[d] = 0;
+        }
+    }
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::bry_int_t BRY::FixedPolynomial<DIM, DEG>::degree() {
+    return DEG;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+template <typename ... DEGS>
+constexpr BRY::bry_float_t& BRY::FixedPolynomial<DIM, DEG>::coeff(DEGS ... exponents) {
+    static_assert(is_uniform_convertible_type<bry_int_t, DEGS ...>(), "All parameters passed to `coeff` must be degree type (`bry_int_t`)");
+    static_assert(sizeof...(DEGS) == DIM, "Number of exponents must match the dimension of the polynomial");
+    return coeff(std::array<bry_int_t, DIM>{static_cast<bry_int_t>(exponents) ...});
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::bry_float_t& BRY::FixedPolynomial<DIM, DEG>::coeff(const std::array<bry_int_t, DIM>& exponents) {
+    std::size_t i = 0;
+    for (std::size_t d = 0; d < DIM; ++d)
+        i += exponents[d] * stride(d);
+    return m_coeffs[i];
+}
+
+template <std::size_t DIM, std::size_t DEG>
+template <typename ... DEGS>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::coeff(DEGS ... exponents) const {
+    static_assert(is_uniform_convertible_type<bry_int_t, DEGS ...>(), "All parameters passed to `coeff` must be degree type (`bry_int_t`)");
+    static_assert(sizeof...(DEGS) == DIM, "Number of exponents must match the dimension of the polynomial");
+    return coeff(std::array<bry_int_t, DIM>{static_cast<bry_int_t>(exponents) ...});
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::coeff(const std::array<bry_int_t, DIM>& exponents) const {
+    std::size_t i = 0;
+    for (std::size_t d = 0; d < DIM; ++d)
+        i += exponents[d] * stride(d);
+    return m_coeffs[i];
+}
+
+template <std::size_t DIM, std::size_t DEG>
+template <typename ... FLTS>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::operator()(FLTS ... x) const {
+    static_assert(is_uniform_convertible_type<bry_float_t, FLTS ...>(), "All parameters passed to `operator()` must be float type (`bry_float_t`)");
+    static_assert(sizeof...(FLTS) == DIM, "Number of x parameters must match the dimension of the polynomial");
+    return operator()(std::array<bry_float_t, DIM>{static_cast<bry_float_t>(x) ...});
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::operator()(const std::array<bry_float_t, DIM>& x) const {
+    return horner<DIM - 1>(m_coeffs.data(), x);
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> BRY::FixedPolynomial<DIM, DEG>::derivative(bry_int_t dx_idx) const {
+    BRY_ASSERT(dx_idx < static_cast<bry_int_t>(DIM) && dx_idx >= 0, "Derivative idx out of bounds");
+    FixedPolynomial<DIM, DEG> result;
+    std::size_t dx_stride = stride(dx_idx);
+    for (std::size_t i = 0; i < s_size; ++i) {
+        // Power rule, shifting the coefficient down by one exponent
+        std::size_t exp = (i / dx_stride) % (DEG + 1);
+        if (exp > 0)
+            result.m_coeffs[i - dx_stride] = static_cast<bry_float_t>(exp) * m_coeffs[i];
+    }
+    return result;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+BRY::Polynomial<DIM, BRY::Basis::Power> BRY::FixedPolynomial<DIM, DEG>::toDense() const {
+    Eigen::Tensor<bry_float_t, DIM> tensor(makeUniformArray<bry_int_t, DIM>(DEG + 1));
+    std::copy(m_coeffs.begin(), m_coeffs.end(), tensor.data());
+    return Polynomial<DIM, Basis::Power>(std::move(tensor));
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr const std::array<BRY::bry_float_t, BRY::FixedPolynomial<DIM, DEG>::s_size>& BRY::FixedPolynomial<DIM, DEG>::coefficients() const {
+    return m_coeffs;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr std::size_t BRY::FixedPolynomial<DIM, DEG>::stride(std::size_t d) {
+    std::size_t s = 1;
+    for (std::size_t i = 0; i < d; ++i)
+        s *= DEG + 1;
+    return s;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+template <std::size_t D>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::horner(const bry_float_t* coeffs, const std::array<bry_float_t, DIM>& x) {
+    return hornerUnrolled<D>(coeffs, x, std::make_index_sequence<DEG + 1>{});
+}
+
+template <std::size_t DIM, std::size_t DEG>
+template <std::size_t D, std::size_t ... K>
+constexpr BRY::bry_float_t BRY::FixedPolynomial<DIM, DEG>::hornerUnrolled(const bry_float_t* coeffs, const std::array<bry_float_t, DIM>& x, std::index_sequence<K ...>) {
+    constexpr std::size_t d_stride = stride(D);
+    bry_float_t acc = 0.0;
+    if constexpr (D == 0) {
+        ((acc = acc * x[0] + coeffs[DEG - K]), ...);
+    } else {
+        ((acc = acc * x[D] + horner<D - 1>(coeffs + (DEG - K) * d_stride, x)), ...);
+    }
+    return acc;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator+(const BRY::FixedPolynomial<DIM, DEG>& p_1, const BRY::FixedPolynomial<DIM, DEG>& p_2) {
+    std::array<BRY::bry_float_t, BRY::FixedPolynomial<DIM, DEG>::s_size> coeffs{};
+    for (std::size_t i = 0; i < coeffs.size(); ++i)
+        coeffs[i] = p_1.coefficients()[i] + p_2.coefficients()[i];
+    return BRY::FixedPolynomial<DIM, DEG>(coeffs);
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator-(const BRY::FixedPolynomial<DIM, DEG>& p) {
+    return -1.0 * p;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator-(const BRY::FixedPolynomial<DIM, DEG>& p_1, const BRY::FixedPolynomial<DIM, DEG>& p_2) {
+    return p_1 + -p_2;
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator*(BRY::bry_float_t scalar, const BRY::FixedPolynomial<DIM, DEG>& p) {
+    std::array<BRY::bry_float_t, BRY::FixedPolynomial<DIM, DEG>::s_size> coeffs{};
+    for (std::size_t i = 0; i < coeffs.size(); ++i)
+        coeffs[i] = scalar * p.coefficients()[i];
+    return BRY::FixedPolynomial<DIM, DEG>(coeffs);
+}
+
+template <std::size_t DIM, std::size_t DEG>
+constexpr BRY::FixedPolynomial<DIM, DEG> operator*(const BRY::FixedPolynomial<DIM, DEG>& p, BRY::bry_float_t scalar) {
+    return scalar * p;
+}
+
+template <std::size_t DIM, std::size_t DEG_1, std::size_t DEG_2>
+constexpr BRY::FixedPolynomial<DIM, DEG_1 + DEG_2> operator*(const BRY::FixedPolynomial<DIM, DEG_1>& p_1, const BRY::FixedPolynomial<DIM, DEG_2>& p_2) {
+    using Product = BRY::FixedPolynomial<DIM, DEG_1 + DEG_2>;
+    std::array<BRY::bry_float_t, Product::s_size> coeffs{};
+
+    // Offset of every coefficient of each factor in the product
+    auto productOffsets = [] (std::size_t n, std::size_t deg) {
+        std::array<std::size_t, std::max(BRY::FixedPolynomial<DIM, DEG_1>::s_size, BRY::FixedPolynomial<DIM, DEG_2>::s_size)> offsets{};
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t remainder = i;
+            for (std::size_t d = 0; d < DIM; ++d) {
+                offsets[i] += (remainder % (deg + 1)) * Product::stride(d);
+                remainder /= deg + 1;
+            }
+        }
+        return offsets;
+    };
+    auto offsets_1 = productOffsets(BRY::FixedPolynomial<DIM, DEG_1>::s_size, DEG_1);
+    auto offsets_2 = productOffsets(BRY::FixedPolynomial<DIM, DEG_2>::s_size, DEG_2);
+
+    for (std::size_t i = 0; i < BRY::FixedPolynomial<DIM, DEG_1>::s_size; ++i) {
+        for (std::size_t j = 0; j < BRY::FixedPolynomial<DIM, DEG_2>::s_size; ++j)
+            coeffs[offsets_1[i] + offsets_2[j]] += p_1.coefficients()[i] * p_2.coefficients()[j];
+    }
+    return Product(coeffs);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <sstream>
+
+const char* BRY::operationName(Operation operation) {
+    switch (operation) {
+        case Operation::Add:                        return "add";
+        case Operation::Subtract:                   return "subtract";
+        case Operation::Negate:                     return "negate";
+        case Operation::Scale:                      return "scale";
+        case Operation::Multiply:                   return "multiply";
+        case Operation::Power:                      return "power";
+        case Operation::Powers:                     return "powers";
+        case Operation::DirectMultiply:             return "direct_multiply";
+        case Operation::KaratsubaMultiply:          return "karatsuba_multiply";
+        case Operation::FFTMultiply:                return "fft_multiply";
+        case Operation::FFTPower:                   return "fft_power";
+        case Operation::FFTPowers:                  return "fft_powers";
+        case Operation::Evaluate:                   return "evaluate";
+        case Operation::EvaluateBatch:              return "evaluate_batch";
+        case Operation::Derivative:                 return "derivative";
+        case Operation::LiftDegree:                 return "lift_degree";
+        case Operation::Reparameterize:             return "reparameterize";
+        case Operation::Transform:                  return "transform";
+        case Operation::PwrToBernMatrix:            return "pwr_to_bern_matrix";
+        case Operation::BernToPwrMatrix:            return "bern_to_pwr_matrix";
+        case Operation::PwrToBernSparseMatrix:      return "pwr_to_bern_sparse_matrix";
+        case Operation::BernToPwrSparseMatrix:      return "bern_to_pwr_sparse_matrix";
+        case Operation::PwrToBernTransform:         return "pwr_to_bern_transform";
+        case Operation::BernToPwrTransform:         return "bern_to_pwr_transform";
+        case Operation::DegreeChangeMatrix:         return "degree_change_matrix";
+        case Operation::SparseDegreeChangeMatrix:   return "sparse_degree_change_matrix";
+        case Operation::InfBound:                   return "inf_bound";
+        case Operation::InfBoundGap:                return "inf_bound_gap";
+        case Operation::Bound:                      return "bound";
+        case Operation::Subdivide:                  return "subdivide";
+        case Operation::Count:                      break;
+    }
+    return "unknown";
+}
+
+/* Instrumentation Snapshot */
+
+const BRY::OperationStatistics& BRY::InstrumentationSnapshot::operator[](Operation operation) const {
+    return operations[static_cast<std::size_t>(operation)];
+}
+
+std::string BRY::InstrumentationSnapshot::toJson() const {
+    std::ostringstream os;
+    os << "{";
+    bool first = true;
+    for (std::size_t i = 0; i < s_n_operations; ++i) {
+        const OperationStatistics& stats = operations[i];
+        if (stats.calls == 0)
+            continue;
+        os << (first ? "" : ", ") << "\"" << operationName(static_cast<Operation>(i)) << "\": {"
+            << "\"calls\": " << stats.calls
+            << ", \"nanoseconds\": " << stats.nanoseconds
+            << ", \"coefficients\": " << stats.coefficients
+            << ", \"bytes_allocated\": " << stats.bytes_allocated << "}";
+        first = false;
+    }
+    os << "}";
+    return os.str();
+}
+
+/* Instrumentation */
+
+constexpr bool BRY::Instrumentation::enabled() {
+#ifdef BRY_ENABLE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+BRY::InstrumentationSnapshot BRY::Instrumentation::snapshot() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    InstrumentationSnapshot snapshot;
+    snapshot.operations = reg.retired;
+    for (const ThreadCounters* thread : reg.threads) {
+        for (std::size_t i = 0; i < s_n_operations; ++i) {
+            const Counters& counters = thread->operations[i];
+            OperationStatistics& stats = snapshot.operations[i];
+            stats.calls += counters.calls.load(std::memory_order_relaxed);
+            stats.nanoseconds += counters.nanoseconds.load(std::memory_order_relaxed);
+            stats.coefficients += counters.coefficients.load(std::memory_order_relaxed);
+            stats.bytes_allocated += counters.bytes_allocated.load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+void BRY::Instrumentation::reset() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    reg.retired = {};
+    for (ThreadCounters* thread : reg.threads) {
+        for (Counters& counters : thread->operations) {
+            counters.calls.store(0, std::memory_order_relaxed);
+            counters.nanoseconds.store(0, std::memory_order_relaxed);
+            counters.coefficients.store(0, std::memory_order_relaxed);
+            counters.bytes_allocated.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void BRY::Instrumentation::record(Operation operation, std::size_t nanoseconds, std::size_t coefficients, std::size_t bytes_allocated) {
+    // Only the owning thread writes its counters, so a relaxed load and store is enough
+    Counters& counters = threadCounters().operations[static_cast<std::size_t>(operation)];
+    counters.calls.store(counters.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    counters.nanoseconds.store(counters.nanoseconds.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+    counters.coefficients.store(counters.coefficients.load(std::memory_order_relaxed) + coefficients, std::memory_order_relaxed);
+    counters.bytes_allocated.store(counters.bytes_allocated.load(std::memory_order_relaxed) + bytes_allocated, std::memory_order_relaxed);
+}
+
+BRY::Instrumentation::ThreadCounters::ThreadCounters() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.threads.push_back(this);
+}
+
+BRY::Instrumentation::ThreadCounters::~ThreadCounters() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (std::size_t i = 0; i < s_n_operations; ++i) {
+        OperationStatistics& stats = reg.retired[i];
+        stats.calls += operations[i].calls.load(std::memory_order_relaxed);
+        stats.nanoseconds += operations[i].nanoseconds.load(std::memory_order_relaxed);
+        stats.coefficients += operations[i].coefficients.load(std::memory_order_relaxed);
+        stats.bytes_allocated += operations[i].bytes_allocated.load(std::memory_order_relaxed);
+    }
+    reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), this));
+}
+
+BRY::Instrumentation::Registry& BRY::Instrumentation::registry() {
+    // Constructed before (and so destroyed after) the thread-local counters of any thread
+    static Registry registry;
+    return registry;
+}
+
+BRY::Instrumentation::ThreadCounters& BRY::Instrumentation::threadCounters() {
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+/* Scoped Probe */
+
+BRY::ScopedProbe::ScopedProbe(Operation operation, std::size_t coefficients)
+    : m_operation(operation)
+    , m_coefficients(coefficients)
+    , m_start(std::chrono::steady_clock::now())
+{}
+
+BRY::ScopedProbe::~ScopedProbe() {
+    std::size_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+    Instrumentation::record(m_operation, nanoseconds, m_coefficients, m_bytes_allocated);
+}
+
+void BRY::ScopedProbe::setBytes(std::size_t bytes_allocated) {
+    m_bytes_allocated = bytes_allocated;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "KroneckerTransform.h"
+
+#include "lemon/Logging.h"
+
+template <std::size_t DIM>
+BRY::KroneckerTransform<DIM>::KroneckerTransform(const std::array<Matrix, DIM>& factors)
+    : m_factors(factors)
+{}
+
+template <std::size_t DIM>
+BRY::KroneckerTransform<DIM>::KroneckerTransform(std::array<Matrix, DIM>&& factors)
+    : m_factors(std::move(factors))
+{}
+
+template <std::size_t DIM>
+BRY::KroneckerTransform<DIM>::KroneckerTransform(const Matrix& factor)
+{
+    m_factors.fill(factor);
+}
+
+template <std::size_t DIM>
+const BRY::Matrix& BRY::KroneckerTransform<DIM>::factor(std::size_t d) const {
+    BRY_ASSERT(d < DIM, "Factor dimension out of bounds");
+    return m_factors[d];
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::KroneckerTransform<DIM>::rows() const {
+    bry_int_t rows = 1;
+    for (const Matrix& f : m_factors)
+        rows *= f.rows();
+    return rows;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::KroneckerTransform<DIM>::cols() const {
+    bry_int_t cols = 1;
+    for (const Matrix& f : m_factors)
+        cols *= f.cols();
+    return cols;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::KroneckerTransform<DIM>::apply(const Eigen::Tensor<bry_float_t, DIM>& tensor) const {
+    std::array<bry_int_t, DIM> dims = tensor.dimensions();
+#ifdef BRY_ENABLE_BOUNDS_CHECK
+    for (std::size_t d = 0; d < DIM; ++d)
+        ASSERT(dims[d] == m_factors[d].cols(), "Tensor dimension " << d << " does not match the factor size");
+#endif
+
+    // Ping-pong between two tensors, one mode at a time
+    Eigen::Tensor<bry_float_t, DIM> src;
+    Eigen::Tensor<bry_float_t, DIM> dst;
+    const bry_float_t* src_data = tensor.data();
+    for (std::size_t d = 0; d < DIM; ++d) {
+        std::array<bry_int_t, DIM> dst_dims = dims;
+        dst_dims[d] = m_factors[d].rows();
+        dst.resize(dst_dims);
+
+        modeProduct<DIM>(src_data, dst.data(), dims, d, m_factors[d]);
+
+        std::swap(src, dst);
+        src_data = src.data();
+        dims = dst_dims;
+    }
+    return src;
+}
+
+template <std::size_t DIM>
+BRY::Matrix BRY::KroneckerTransform<DIM>::toMatrix() const {
+    Matrix kron = m_factors[0];
+    for (std::size_t d = 1; d < DIM; ++d) {
+        const Matrix& f = m_factors[d];
+
+        // Higher dimensions are the slower varying (outer) blocks in the vectorized form
+        Matrix next(f.rows() * kron.rows(), f.cols() * kron.cols());
+        for (bry_int_t i = 0; i < f.rows(); ++i) {
+            for (bry_int_t j = 0; j < f.cols(); ++j) {
+                next.block(i * kron.rows(), j * kron.cols(), kron.rows(), kron.cols()) = f(i, j) * kron;
+            }
+        }
+        kron = std::move(next);
+    }
+    return kron;
+}
+
+template <std::size_t DIM>
+void BRY::modeProduct(const bry_float_t* src, bry_float_t* dst, const std::array<bry_int_t, DIM>& src_dims, std::size_t mode, const Matrix& factor) {
+    // View the tensor as (left x n x right), where 'left' are the faster varying dimensions
+    bry_int_t left = 1;
+    for (std::size_t d = 0; d < mode; ++d)
+        left *= src_dims[d];
+
+    bry_int_t right = 1;
+    for (std::size_t d = mode + 1; d < DIM; ++d)
+        right *= src_dims[d];
+
+    bry_int_t n_in = factor.cols();
+    bry_int_t n_out = factor.rows();
+
+    if (left == 1) {
+        // Fibers along the mode are contiguous, so the whole tensor is one (n x right) matrix
+        Eigen::Map<const Matrix> src_mat(src, n_in, right);
+        Eigen::Map<Matrix> dst_mat(dst, n_out, right);
+        dst_mat.noalias() = factor * src_mat;
+        return;
+    }
+
+    for (bry_int_t r = 0; r < right; ++r) {
+        Eigen::Map<const Matrix> src_slab(src + r * left * n_in, left, n_in);
+        Eigen::Map<Matrix> dst_slab(dst + r * left * n_out, left, n_out);
+        dst_slab.noalias() = src_slab * factor.transpose();
+    }
+}
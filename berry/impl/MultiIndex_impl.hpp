@@ -114,6 +114,7 @@ BRY::FixedNormIncrementer::FixedNormIncrementer(bry_int_t*& _initial_idx, std::s
         _initial_idx = new bry_int_t[sz];
     }
 
+    std::fill_n(_initial_idx, sz, 0);
     if (first) {
         std::fill_n(m_combination.begin(), index_constraint - 1, true);
         _initial_idx[0] = index_constraint - 1;
@@ -244,7 +245,7 @@ BRY::MultiIndex<INCREMENTER>::MultiIndex(bry_int_t* array, std::size_t sz, bool
     , m_last(!first)
     , m_external_arr(true)
 {
-    ASSERT(sz, "Size must be geq 0");
+    BRY_ASSERT(sz, "Size must be geq 0");
 }
 
 template <class INCREMENTER>
@@ -314,9 +315,7 @@ bool BRY::MultiIndex<INCREMENTER>::last() const {
 
 template <class INCREMENTER>
 BRY::bry_int_t BRY::MultiIndex<INCREMENTER>::operator[](std::size_t d) const {
-#ifdef BRY_ENABLE_BOUNDS_CHECK
-    ASSERT(d < m_sz, "Subscript d is out of bounds");
-#endif
+    BRY_ASSERT(d < m_sz, "Subscript d is out of bounds");
     return m_idx[d];
 }
 
@@ -372,4 +371,158 @@ BRY::MultiIndex<BRY::BoundedExhaustiveIncrementerWrap> BRY::mIdxBEW(const std::v
 
 BRY::MultiIndex<BRY::BoundedExhaustiveIncrementerWrap> BRY::rmIdxBEW(const std::vector<bry_int_t>& index_bounds, bry_int_t index_constraint) {
     return BRY::MultiIndex<BRY::BoundedExhaustiveIncrementerWrap>(index_bounds.size(), false, index_bounds, index_constraint);
-}
\ No newline at end of file
+}
+/* Static MultiIndex */
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM>::Iterator::Iterator(const StaticMultiIndex& midx)
+    : m_midx(midx)
+{}
+
+template <std::size_t DIM>
+const BRY::StaticMultiIndex<DIM>& BRY::StaticMultiIndex<DIM>::Iterator::operator*() const {
+    return m_midx;
+}
+
+template <std::size_t DIM>
+const BRY::StaticMultiIndex<DIM>* BRY::StaticMultiIndex<DIM>::Iterator::operator->() const {
+    return &m_midx;
+}
+
+template <std::size_t DIM>
+typename BRY::StaticMultiIndex<DIM>::Iterator& BRY::StaticMultiIndex<DIM>::Iterator::operator++() {
+    ++m_midx;
+    return *this;
+}
+
+template <std::size_t DIM>
+bool BRY::StaticMultiIndex<DIM>::Iterator::operator!=(const Iterator& other) const {
+    return m_midx.last() != other.m_midx.last();
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM>::StaticMultiIndex(bry_int_t index_constraint)
+    : StaticMultiIndex([index_constraint] {
+        std::array<bry_int_t, DIM> index_bounds;
+        index_bounds.fill(index_constraint);
+        return index_bounds;
+    }(), index_constraint)
+{}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM>::StaticMultiIndex(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint)
+    : m_bounds(index_bounds)
+    , m_wrapped_idx(0)
+    , m_last(false)
+{
+    static_assert(DIM > 0, "Dimension must be positive");
+    m_idx.fill(0);
+    bry_int_t stride = 1;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        BRY_ASSERT(index_bounds[d] <= index_constraint, "Index bound exceeds the index constraint");
+        m_strides[d] = stride;
+        stride *= index_constraint;
+        if (index_bounds[d] <= 0)
+            m_last = true;
+    }
+}
+
+template <std::size_t DIM>
+constexpr std::size_t BRY::StaticMultiIndex<DIM>::size() {
+    return DIM;
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM>& BRY::StaticMultiIndex<DIM>::operator++() {
+    for (std::size_t d = 0; d < DIM; ++d) {
+        m_wrapped_idx += m_strides[d];
+        if (++m_idx[d] < m_bounds[d])
+            return *this;
+
+        // Carry into the next unary index
+        m_wrapped_idx -= m_idx[d] * m_strides[d];
+        m_idx[d] = 0;
+    }
+    m_last = true;
+    return *this;
+}
+
+template <std::size_t DIM>
+bool BRY::StaticMultiIndex<DIM>::last() const {
+    return m_last;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::StaticMultiIndex<DIM>::wrappedIdx() const {
+    return m_wrapped_idx;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::StaticMultiIndex<DIM>::operator[](std::size_t d) const {
+    BRY_ASSERT(d < DIM, "Subscript d is out of bounds");
+    return m_idx[d];
+}
+
+template <std::size_t DIM>
+const std::array<BRY::bry_int_t, DIM>& BRY::StaticMultiIndex<DIM>::idx() const {
+    return m_idx;
+}
+
+template <std::size_t DIM>
+const BRY::bry_int_t* BRY::StaticMultiIndex<DIM>::begin() const {
+    return m_idx.data();
+}
+
+template <std::size_t DIM>
+const BRY::bry_int_t* BRY::StaticMultiIndex<DIM>::end() const {
+    return m_idx.data() + DIM;
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndexRange<DIM>::StaticMultiIndexRange(const StaticMultiIndex<DIM>& first)
+    : m_first(first)
+{}
+
+template <std::size_t DIM>
+typename BRY::StaticMultiIndex<DIM>::Iterator BRY::StaticMultiIndexRange<DIM>::begin() const {
+    return typename StaticMultiIndex<DIM>::Iterator(m_first);
+}
+
+template <std::size_t DIM>
+typename BRY::StaticMultiIndex<DIM>::Iterator BRY::StaticMultiIndexRange<DIM>::end() const {
+    StaticMultiIndex<DIM> past_last = m_first;
+    past_last.m_last = true;
+    return typename StaticMultiIndex<DIM>::Iterator(past_last);
+}
+
+template <std::size_t DIM>
+std::ostream& operator<<(std::ostream& os, const BRY::StaticMultiIndex<DIM>& idx) {
+    os << LMN_LOG_BWHITE("[");
+    for (std::size_t i = 0; i < DIM; ++i) {
+        os << LMN_LOG_GREEN(idx[i]);
+        if (i < DIM - 1)
+            os << LMN_LOG_WHITE(", ");
+    }
+    os << LMN_LOG_BWHITE("]");
+    return os;
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM> BRY::smIdx(bry_int_t index_constraint) {
+    return BRY::StaticMultiIndex<DIM>(index_constraint);
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndex<DIM> BRY::smIdxB(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint) {
+    return BRY::StaticMultiIndex<DIM>(index_bounds, index_constraint);
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndexRange<DIM> BRY::smIdxRange(bry_int_t index_constraint) {
+    return BRY::StaticMultiIndexRange<DIM>(BRY::StaticMultiIndex<DIM>(index_constraint));
+}
+
+template <std::size_t DIM>
+BRY::StaticMultiIndexRange<DIM> BRY::smIdxRange(const std::array<bry_int_t, DIM>& index_bounds, bry_int_t index_constraint) {
+    return BRY::StaticMultiIndexRange<DIM>(BRY::StaticMultiIndex<DIM>(index_bounds, index_constraint));
+}
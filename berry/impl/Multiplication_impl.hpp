@@ -0,0 +1,461 @@
+#pragma once
+
+#include "Multiplication.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace _BRY {
+
+/// @brief View of a (possibly strided) coefficient tensor. The stride of dimension 0 is always 1
+template <std::size_t DIM>
+struct TensorSpan {
+    const BRY::bry_float_t* data;
+    std::array<BRY::bry_int_t, DIM> dims;
+    std::array<BRY::bry_int_t, DIM> strides;
+};
+
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> contiguousStrides(const std::array<BRY::bry_int_t, DIM>& dims) {
+    std::array<BRY::bry_int_t, DIM> strides;
+    BRY::bry_int_t stride = 1;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        strides[d] = stride;
+        stride *= dims[d];
+    }
+    return strides;
+}
+
+/// @brief Call `fn(offset_1, offset_2)` for every index of `dims` along dimensions `first_dim`, ..., DIM - 1
+template <std::size_t DIM, typename FUNC>
+void forEachOffset(const std::array<BRY::bry_int_t, DIM>& dims, const std::array<BRY::bry_int_t, DIM>& strides_1,
+        const std::array<BRY::bry_int_t, DIM>& strides_2, std::size_t first_dim, FUNC&& fn) {
+    for (std::size_t d = first_dim; d < DIM; ++d) {
+        if (dims[d] == 0)
+            return;
+    }
+
+    std::array<BRY::bry_int_t, DIM> idx{};
+    BRY::bry_int_t offset_1 = 0;
+    BRY::bry_int_t offset_2 = 0;
+    while (true) {
+        fn(offset_1, offset_2);
+
+        std::size_t d = first_dim;
+        for (; d < DIM; ++d) {
+            offset_1 += strides_1[d];
+            offset_2 += strides_2[d];
+            if (++idx[d] < dims[d])
+                break;
+            offset_1 -= dims[d] * strides_1[d];
+            offset_2 -= dims[d] * strides_2[d];
+            idx[d] = 0;
+        }
+        if (d == DIM)
+            return;
+    }
+}
+
+/// @brief dst += scale * src over the extents of `src`
+template <std::size_t DIM>
+void accumulate(const TensorSpan<DIM>& src, BRY::bry_float_t* dst, const std::array<BRY::bry_int_t, DIM>& dst_strides, BRY::bry_float_t scale) {
+    forEachOffset<DIM>(src.dims, src.strides, dst_strides, 1, [&] (BRY::bry_int_t src_offset, BRY::bry_int_t dst_offset) {
+        const BRY::bry_float_t* src_row = src.data + src_offset;
+        BRY::bry_float_t* dst_row = dst + dst_offset;
+        for (BRY::bry_int_t k = 0; k < src.dims[0]; ++k)
+            dst_row[k] += scale * src_row[k];
+    });
+}
+
+/// @brief out += a * b (schoolbook convolution)
+template <std::size_t DIM>
+void convolveDirect(const TensorSpan<DIM>& a, const TensorSpan<DIM>& b, BRY::bry_float_t* out, const std::array<BRY::bry_int_t, DIM>& out_strides) {
+    forEachOffset<DIM>(a.dims, a.strides, out_strides, 0, [&] (BRY::bry_int_t a_offset, BRY::bry_int_t out_offset) {
+        BRY::bry_float_t a_coeff = a.data[a_offset];
+        if (a_coeff == 0.0)
+            return;
+
+        // Add the scaled b tensor shifted to the index of the a coefficient
+        accumulate<DIM>(b, out + out_offset, out_strides, a_coeff);
+    });
+}
+
+/// @brief out += a * b (multivariate Karatsuba)
+template <std::size_t DIM>
+void convolveKaratsuba(const TensorSpan<DIM>& a, const TensorSpan<DIM>& b, BRY::bry_float_t* out, const std::array<BRY::bry_int_t, DIM>& out_strides, BRY::bry_int_t threshold) {
+    // Split the dimension along which both factors are largest
+    std::size_t split_dim = 0;
+    BRY::bry_int_t split_size = 0;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        BRY::bry_int_t size = std::min(a.dims[d], b.dims[d]);
+        if (size > split_size) {
+            split_dim = d;
+            split_size = size;
+        }
+    }
+
+    if (split_size - 1 < std::max<BRY::bry_int_t>(threshold, 1)) {
+        convolveDirect<DIM>(a, b, out, out_strides);
+        return;
+    }
+
+    // a = a_0 + x^h a_1, b = b_0 + x^h b_1 along the split dimension
+    BRY::bry_int_t h = (split_size + 1) / 2;
+    auto lowerPart = [&] (const TensorSpan<DIM>& t) {
+        TensorSpan<DIM> part = t;
+        part.dims[split_dim] = h;
+        return part;
+    };
+    auto upperPart = [&] (const TensorSpan<DIM>& t) {
+        TensorSpan<DIM> part = t;
+        part.data += h * t.strides[split_dim];
+        part.dims[split_dim] -= h;
+        return part;
+    };
+    auto productDims = [] (const TensorSpan<DIM>& t_1, const TensorSpan<DIM>& t_2) {
+        std::array<BRY::bry_int_t, DIM> dims;
+        for (std::size_t d = 0; d < DIM; ++d)
+            dims[d] = t_1.dims[d] + t_2.dims[d] - 1;
+        return dims;
+    };
+    auto size = [] (const std::array<BRY::bry_int_t, DIM>& dims) {
+        BRY::bry_int_t sz = 1;
+        for (BRY::bry_int_t dim_sz : dims)
+            sz *= dim_sz;
+        return sz;
+    };
+
+    // Scratch buffers are drawn from the thread arena, the recursive calls rewind their own buffers before returning
+    BRY::ScopedArena scope;
+    auto zeros = [&] (BRY::bry_int_t n) {
+        BRY::bry_float_t* buffer = scope.arena().allocate<BRY::bry_float_t>(n);
+        std::fill_n(buffer, n, 0.0);
+        return buffer;
+    };
+
+    // Contiguous sum of the lower and upper parts
+    auto sumParts = [&] (const TensorSpan<DIM>& t) {
+        TensorSpan<DIM> lower = lowerPart(t);
+        TensorSpan<DIM> upper = upperPart(t);
+        std::array<BRY::bry_int_t, DIM> dims = lower.dims;
+        dims[split_dim] = std::max(lower.dims[split_dim], upper.dims[split_dim]);
+        std::array<BRY::bry_int_t, DIM> strides = contiguousStrides<DIM>(dims);
+
+        BRY::bry_float_t* buffer = zeros(size(dims));
+        accumulate<DIM>(lower, buffer, strides, 1.0);
+        accumulate<DIM>(upper, buffer, strides, 1.0);
+        return TensorSpan<DIM>{buffer, dims, strides};
+    };
+
+    TensorSpan<DIM> a_0 = lowerPart(a);
+    TensorSpan<DIM> a_1 = upperPart(a);
+    TensorSpan<DIM> b_0 = lowerPart(b);
+    TensorSpan<DIM> b_1 = upperPart(b);
+
+    TensorSpan<DIM> a_sum = sumParts(a);
+    TensorSpan<DIM> b_sum = sumParts(b);
+
+    // z_0 = a_0 b_0, z_2 = a_1 b_1, z_1 = (a_0 + a_1)(b_0 + b_1)
+    std::array<BRY::bry_int_t, DIM> z_0_dims = productDims(a_0, b_0);
+    std::array<BRY::bry_int_t, DIM> z_2_dims = productDims(a_1, b_1);
+    std::array<BRY::bry_int_t, DIM> z_1_dims = productDims(a_sum, b_sum);
+    std::array<BRY::bry_int_t, DIM> z_0_strides = contiguousStrides<DIM>(z_0_dims);
+    std::array<BRY::bry_int_t, DIM> z_2_strides = contiguousStrides<DIM>(z_2_dims);
+    std::array<BRY::bry_int_t, DIM> z_1_strides = contiguousStrides<DIM>(z_1_dims);
+    BRY::bry_float_t* z_0 = zeros(size(z_0_dims));
+    BRY::bry_float_t* z_2 = zeros(size(z_2_dims));
+    BRY::bry_float_t* z_1 = zeros(size(z_1_dims));
+    convolveKaratsuba<DIM>(a_0, b_0, z_0, z_0_strides, threshold);
+    convolveKaratsuba<DIM>(a_1, b_1, z_2, z_2_strides, threshold);
+    convolveKaratsuba<DIM>(a_sum, b_sum, z_1, z_1_strides, threshold);
+
+    TensorSpan<DIM> z_0_span{z_0, z_0_dims, z_0_strides};
+    TensorSpan<DIM> z_2_span{z_2, z_2_dims, z_2_strides};
+
+    // z_1 - z_0 - z_2 = a_0 b_1 + a_1 b_0
+    accumulate<DIM>(z_0_span, z_1, z_1_strides, -1.0);
+    accumulate<DIM>(z_2_span, z_1, z_1_strides, -1.0);
+
+    // Drop the (cancelled) entries of z_1 beyond the support of a_0 b_1 + a_1 b_0
+    TensorSpan<DIM> middle{z_1, z_1_dims, z_1_strides};
+    middle.dims[split_dim] = std::min(z_1_dims[split_dim], std::max(a.dims[split_dim], b.dims[split_dim]) - 1);
+
+    accumulate<DIM>(z_0_span, out, out_strides, 1.0);
+    accumulate<DIM>(middle, out + h * out_strides[split_dim], out_strides, 1.0);
+    accumulate<DIM>(z_2_span, out + 2 * h * out_strides[split_dim], out_strides, 1.0);
+}
+
+}
+
+namespace _BRY {
+
+BRY_INL std::atomic<BRY::ProductMode>& productModeSetting() {
+    static std::atomic<BRY::ProductMode> mode(BRY::ProductMode::Fast);
+    return mode;
+}
+
+}
+
+BRY::ProductMode BRY::productMode() {
+    return _BRY::productModeSetting().load(std::memory_order_relaxed);
+}
+
+void BRY::setProductMode(ProductMode mode) {
+    _BRY::productModeSetting().store(mode, std::memory_order_relaxed);
+}
+
+template <std::size_t DIM>
+constexpr BRY::MultiplicationThresholds BRY::Multiplication<DIM>::defaultThresholds() {
+    // Direct convolution was fastest in 1D up to the largest measured degree (128)
+    switch (DIM) {
+        case 1:  return {128, 128};
+        case 2:  return {25, 28};
+        case 3:  return {9, 9};
+        case 4:  return {6, 7};
+        case 5:  return {5, 7};
+        default: return {3, 4};
+    }
+}
+
+template <std::size_t DIM>
+BRY::MultiplicationThresholds BRY::Multiplication<DIM>::thresholds() {
+    return MultiplicationThresholds{s_karatsuba_threshold.load(std::memory_order_relaxed), s_fft_threshold.load(std::memory_order_relaxed)};
+}
+
+template <std::size_t DIM>
+void BRY::Multiplication<DIM>::setThresholds(const MultiplicationThresholds& thresholds) {
+    s_karatsuba_threshold.store(thresholds.karatsuba, std::memory_order_relaxed);
+    s_fft_threshold.store(thresholds.fft, std::memory_order_relaxed);
+}
+
+template <std::size_t DIM>
+BRY::MultiplicationMethod BRY::Multiplication<DIM>::select(bry_int_t degree_1, bry_int_t degree_2) {
+    bry_int_t degree = std::min(degree_1, degree_2);
+    if (degree >= s_fft_threshold.load(std::memory_order_relaxed))
+        return MultiplicationMethod::FFT;
+    if (degree >= s_karatsuba_threshold.load(std::memory_order_relaxed))
+        return MultiplicationMethod::Karatsuba;
+    return MultiplicationMethod::Direct;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::multiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    Eigen::Tensor<bry_float_t, DIM> product;
+    multiplyInto(a, b, product);
+    return product;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::multiply(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, MultiplicationMethod method) {
+    switch (method) {
+        case MultiplicationMethod::Direct:
+            return direct(a, b);
+        case MultiplicationMethod::Karatsuba:
+            return karatsuba(a, b);
+        case MultiplicationMethod::FFT:
+            return fftMultiply<DIM>(a, b);
+    }
+    ERROR("Unrecognized multiplication method");
+    throw std::invalid_argument("Unrecognized multiplication method");
+}
+
+template <std::size_t DIM>
+void BRY::Multiplication<DIM>::multiplyInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result) {
+    // The factors are read while the product is accumulated, so an aliased destination is filled through a temporary
+    if (result.data() != nullptr && (result.data() == a.data() || result.data() == b.data())) {
+        Eigen::Tensor<bry_float_t, DIM> product;
+        multiplyInto(a, b, product);
+        result = std::move(product);
+        return;
+    }
+
+    Eigen::Tensor<bry_int_t, 0> a_nonzero = (a != a.constant(0.0)).template cast<bry_int_t>().sum();
+    Eigen::Tensor<bry_int_t, 0> b_nonzero = (b != b.constant(0.0)).template cast<bry_int_t>().sum();
+
+    MultiplicationMethod method = select(effectiveDegree(a, a_nonzero()), effectiveDegree(b, b_nonzero()));
+    switch (method) {
+        case MultiplicationMethod::Direct:
+            // Skip the zeros of the sparser factor. The direct product is exact on the support
+            if (a_nonzero() <= b_nonzero())
+                directInto(a, b, result);
+            else
+                directInto(b, a, result);
+            return;
+        case MultiplicationMethod::Karatsuba:
+            karatsubaInto(a, b, result);
+            break;
+        case MultiplicationMethod::FFT:
+            result = fftMultiply<DIM>(a, b);
+            break;
+    }
+    if (productMode() == ProductMode::ExactSupport)
+        result = support(a, b).select(result, result.constant(0.0));
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::direct(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    Eigen::Tensor<bry_float_t, DIM> result;
+    directInto(a, b, result);
+    return result;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::karatsuba(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    Eigen::Tensor<bry_float_t, DIM> result;
+    karatsubaInto(a, b, result);
+    return result;
+}
+
+template <std::size_t DIM>
+void BRY::Multiplication<DIM>::directInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result) {
+    BRY_PROBE(DirectMultiply, a.size() + b.size());
+    std::array<bry_int_t, DIM> a_dims = a.dimensions();
+    std::array<bry_int_t, DIM> b_dims = b.dimensions();
+    std::array<bry_int_t, DIM> result_dims = productDimensions(a, b);
+
+    // Resizing to the same number of coefficients keeps the storage
+    result.resize(result_dims);
+    BRY_PROBE_BYTES(result.size() * sizeof(bry_float_t));
+    result.setZero();
+    _BRY::convolveDirect<DIM>(
+        _BRY::TensorSpan<DIM>{a.data(), a_dims, _BRY::contiguousStrides<DIM>(a_dims)},
+        _BRY::TensorSpan<DIM>{b.data(), b_dims, _BRY::contiguousStrides<DIM>(b_dims)},
+        result.data(), _BRY::contiguousStrides<DIM>(result_dims));
+}
+
+template <std::size_t DIM>
+void BRY::Multiplication<DIM>::karatsubaInto(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b, Eigen::Tensor<bry_float_t, DIM>& result) {
+    BRY_PROBE(KaratsubaMultiply, a.size() + b.size());
+    std::array<bry_int_t, DIM> a_dims = a.dimensions();
+    std::array<bry_int_t, DIM> b_dims = b.dimensions();
+    std::array<bry_int_t, DIM> result_dims = productDimensions(a, b);
+
+    result.resize(result_dims);
+    BRY_PROBE_BYTES(result.size() * sizeof(bry_float_t));
+    result.setZero();
+    _BRY::convolveKaratsuba<DIM>(
+        _BRY::TensorSpan<DIM>{a.data(), a_dims, _BRY::contiguousStrides<DIM>(a_dims)},
+        _BRY::TensorSpan<DIM>{b.data(), b_dims, _BRY::contiguousStrides<DIM>(b_dims)},
+        result.data(), _BRY::contiguousStrides<DIM>(result_dims),
+        s_karatsuba_threshold.load(std::memory_order_relaxed));
+}
+
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> BRY::Multiplication<DIM>::productDimensions(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    std::array<bry_int_t, DIM> result_dims;
+    for (std::size_t d = 0; d < DIM; ++d)
+        result_dims[d] = a.dimension(d) + b.dimension(d) - 1;
+    return result_dims;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::Multiplication<DIM>::maxDegree(const Eigen::Tensor<bry_float_t, DIM>& t) {
+    bry_int_t max_dim = 1;
+    for (std::size_t d = 0; d < DIM; ++d)
+        max_dim = std::max<bry_int_t>(max_dim, t.dimension(d));
+    return max_dim - 1;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::power(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp) {
+    BRY_ASSERT(exp >= 0, "Exponent must be non-negative");
+
+    bry_int_t half_degree = (exp / 2) * maxDegree(a);
+    if (select(half_degree, half_degree) == MultiplicationMethod::FFT) {
+        Eigen::Tensor<bry_float_t, DIM> result = fftPower<DIM>(a, exp);
+        if (productMode() == ProductMode::ExactSupport)
+            result = powerSupport(a, exp).select(result, result.constant(0.0));
+        return result;
+    }
+
+    std::array<bry_int_t, DIM> unit_dims;
+    unit_dims.fill(1);
+    Eigen::Tensor<bry_float_t, DIM> result(unit_dims);
+    result.setConstant(1.0);
+
+    // Exponentiation by squaring, where each product is dispatched by size
+    Eigen::Tensor<bry_float_t, DIM> base = a;
+    while (exp > 0) {
+        if (exp & 1)
+            result = multiply(result, base);
+        exp >>= 1;
+        if (exp > 0)
+            base = multiply(base, base);
+    }
+    return result;
+}
+
+template <std::size_t DIM>
+std::vector<Eigen::Tensor<BRY::bry_float_t, DIM>> BRY::Multiplication<DIM>::powers(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t max_exp) {
+    BRY_ASSERT(max_exp >= 0, "Exponent must be non-negative");
+
+    bry_int_t degree = maxDegree(a);
+    if (select(degree, (max_exp - 1) * degree) == MultiplicationMethod::FFT) {
+        std::vector<Eigen::Tensor<bry_float_t, DIM>> result = fftPowers<DIM>(a, max_exp);
+        if (productMode() == ProductMode::ExactSupport) {
+            // a^0 and a^1 are exact
+            Eigen::Tensor<bry_float_t, DIM> a_indicator = indicator(a);
+            Eigen::Tensor<bry_float_t, DIM> power_indicator = a_indicator;
+            for (bry_int_t exp = 2; exp <= max_exp; ++exp) {
+                power_indicator = indicatorProduct(power_indicator, a_indicator);
+                result[exp] = (power_indicator > power_indicator.constant(0.5)).select(result[exp], result[exp].constant(0.0));
+            }
+        }
+        return result;
+    }
+
+    std::array<bry_int_t, DIM> unit_dims;
+    unit_dims.fill(1);
+    std::vector<Eigen::Tensor<bry_float_t, DIM>> result;
+    result.reserve(max_exp + 1);
+    result.emplace_back(unit_dims);
+    result.back().setConstant(1.0);
+    for (bry_int_t exp = 1; exp <= max_exp; ++exp)
+        result.push_back(multiply(result.back(), a));
+    return result;
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<bool, DIM> BRY::Multiplication<DIM>::support(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    Eigen::Tensor<bry_float_t, DIM> product = indicatorProduct(indicator(a), indicator(b));
+    return product > product.constant(0.5);
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<bool, DIM> BRY::Multiplication<DIM>::powerSupport(const Eigen::Tensor<bry_float_t, DIM>& a, bry_int_t exp) {
+    std::array<bry_int_t, DIM> unit_dims;
+    unit_dims.fill(1);
+    Eigen::Tensor<bry_float_t, DIM> result(unit_dims);
+    result.setConstant(1.0);
+
+    // Exponentiation by squaring of the indicator tensor
+    Eigen::Tensor<bry_float_t, DIM> base = indicator(a);
+    while (exp > 0) {
+        if (exp & 1)
+            result = indicatorProduct(result, base);
+        exp >>= 1;
+        if (exp > 0)
+            base = indicatorProduct(base, base);
+    }
+    return result > result.constant(0.5);
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::Multiplication<DIM>::effectiveDegree(const Eigen::Tensor<bry_float_t, DIM>& t, bry_int_t n_nonzero) {
+    bry_int_t degree = static_cast<bry_int_t>(std::ceil(std::pow(static_cast<bry_float_t>(n_nonzero), 1.0 / static_cast<bry_float_t>(DIM)))) - 1;
+    return std::clamp<bry_int_t>(degree, 0, maxDegree(t));
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::indicatorProduct(const Eigen::Tensor<bry_float_t, DIM>& a, const Eigen::Tensor<bry_float_t, DIM>& b) {
+    // The counts are integers, so the roundoff of the fast methods is far below the 0.5 cutoff
+    Eigen::Tensor<bry_float_t, DIM> counts = multiply(a, b, select(maxDegree(a), maxDegree(b)));
+    return (counts > counts.constant(0.5)).template cast<bry_float_t>();
+}
+
+template <std::size_t DIM>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::Multiplication<DIM>::indicator(const Eigen::Tensor<bry_float_t, DIM>& t) {
+    return (t != t.constant(0.0)).template cast<bry_float_t>();
+}
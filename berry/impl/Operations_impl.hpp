@@ -7,6 +7,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include <numeric>
 
 namespace _BRY {
@@ -47,6 +48,42 @@ void _setArrayElement(std::array<T, sizeof...(ARGS_T)>& array, const std::tuple<
     }
 }
 
+/// @brief Pascal triangle (and reciprocals) of rows 0, ..., N - 1 computed at compile time. Row `n` starts at `n * (n + 1) / 2`
+template <std::size_t N>
+struct BinomialTable {
+    static_assert(N <= 68, "Binomial coefficients of rows larger than 67 overflow 64 bits");
+
+    constexpr BinomialTable() {
+        for (std::size_t n = 0; n < N; ++n) {
+            std::size_t row = n * (n + 1) / 2;
+            values[row] = 1;
+            values[row + n] = 1;
+            for (std::size_t k = 1; k < n; ++k)
+                values[row + k] = values[row - n + k - 1] + values[row - n + k];
+        }
+        for (std::size_t i = 0; i < values.size(); ++i)
+            reciprocals[i] = 1.0 / static_cast<BRY::bry_float_t>(values[i]);
+    }
+
+    static constexpr std::size_t index(std::size_t n, std::size_t k) {
+        return n * (n + 1) / 2 + k;
+    }
+
+    std::array<std::size_t, N * (N + 1) / 2> values{};
+    std::array<BRY::bry_float_t, N * (N + 1) / 2> reciprocals{};
+};
+
+inline constexpr BinomialTable<BRY_BINOM_TABLE_SIZE> s_binomial_table{};
+
+/// @brief Factorials 0!, ..., 20! (21! overflows 64 bits)
+inline constexpr std::array<std::size_t, 21> s_factorial_table = [] {
+    std::array<std::size_t, 21> table{};
+    table[0] = 1;
+    for (std::size_t i = 1; i < table.size(); ++i)
+        table[i] = table[i - 1] * i;
+    return table;
+}();
+
 template <std::size_t I, typename... ARGS_T>
 void _setExponentVecElement(BRY::ExponentVec<sizeof...(ARGS_T)>& exp, const std::tuple<ARGS_T&&...>& args_tuple) {
     if constexpr (I < sizeof...(ARGS_T)) {
@@ -58,39 +95,60 @@ void _setExponentVecElement(BRY::ExponentVec<sizeof...(ARGS_T)>& exp, const std:
 }
 
 std::size_t BRY::factorial(std::size_t n) {
-    std::size_t val(1.0);
-    for (std::size_t i = 2; i < n; ++i)
-        val *= i;
-    return val;
+    BRY_ASSERT(n < _BRY::s_factorial_table.size(), "Factorial of `n` overflows 64 bits");
+    return _BRY::s_factorial_table[n];
 }
 
 std::size_t BRY::binom(std::size_t n, std::size_t k) {
-#ifdef BRY_ENABLE_BOUNDS_CHECK
-    ASSERT(k <= n, "`k` must be <= `n`");
-#endif
+    BRY_ASSERT(k <= n, "`k` must be <= `n`");
+    if (n < BRY_BINOM_TABLE_SIZE)
+        return _BRY::s_binomial_table.values[_BRY::s_binomial_table.index(n, k)];
 
+    // Multiplicative formula, dividing out the common factor first so that no intermediate exceeds the result
+    k = std::min(k, n - k);
     std::size_t val(1);
     for (std::size_t i = 1; i < k + 1; ++i) {
-        val *= (n + 1 - i);
-        val /= i;
+        std::size_t g = std::gcd(val, i);
+        val = (val / g) * ((n + 1 - i) / (i / g));
     }
     return val;
 }
 
+BRY::bry_float_t BRY::binomFloat(std::size_t n, std::size_t k) {
+    BRY_ASSERT(k <= n, "`k` must be <= `n`");
+    if (n < BRY_BINOM_TABLE_SIZE)
+        return static_cast<bry_float_t>(_BRY::s_binomial_table.values[_BRY::s_binomial_table.index(n, k)]);
+
+    k = std::min(k, n - k);
+    bry_float_t val = 1.0;
+    for (std::size_t i = 1; i < k + 1; ++i)
+        val *= static_cast<bry_float_t>(n + 1 - i) / static_cast<bry_float_t>(i);
+    return val;
+}
+
+BRY::bry_float_t BRY::binomReciprocal(std::size_t n, std::size_t k) {
+    BRY_ASSERT(k <= n, "`k` must be <= `n`");
+    if (n < BRY_BINOM_TABLE_SIZE)
+        return _BRY::s_binomial_table.reciprocals[_BRY::s_binomial_table.index(n, k)];
+    return 1.0 / binomFloat(n, k);
+}
+
 std::vector<std::size_t> BRY::pascalRow(std::size_t n) {
     std::vector<std::size_t> vals(n + 1);
-    vals.front() = 1;
-    for (std::size_t i = 1; i < n + 1; ++i) {
-        vals[i] = (vals[i - 1] * (n + 1 - i)) / i;
+    if (n < BRY_BINOM_TABLE_SIZE) {
+        const std::size_t* row = _BRY::s_binomial_table.values.data() + _BRY::s_binomial_table.index(n, 0);
+        std::copy(row, row + n + 1, vals.begin());
+        return vals;
     }
+
+    for (std::size_t k = 0; k < n + 1; ++k)
+        vals[k] = binom(n, k);
     return vals;
 }
 
 template <class ITERABLE_T>
 std::size_t BRY::multinom(std::size_t n, const ITERABLE_T& multi_k) {
-#ifdef BRY_ENABLE_BOUNDS_CHECK
-    ASSERT(std::accumulate(multi_k.begin(), multi_k.end(), 0) == n, "the sum of `k` must be == `n`");
-#endif
+    BRY_ASSERT(std::accumulate(multi_k.begin(), multi_k.end(), std::size_t{0}) == n, "the sum of `k` must be == `n`");
 
     std::size_t val(1.0);
     auto it = multi_k.begin();
@@ -177,28 +235,52 @@ template <std::size_t DIM>
 static BRY::Matrix BRY::makeDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg) {
     bry_int_t rows = pow(to_deg + 1, DIM);
     bry_int_t cols = pow(from_deg + 1, DIM);
+    BRY_PROBE(DegreeChangeMatrix, cols);
     //DEBUG("rows: " << rows << " cols: " << cols);
     Matrix tf = Matrix::Zero(rows, cols);
-    auto row_midx = mIdxW(DIM, to_deg + 1);
-    auto col_midx = mIdxW(DIM, from_deg + 1);
-    while (!row_midx.last() && !col_midx.last()) {
-        bry_int_t i = 0;
-        //DEBUG("row: " << row_midx << " col: " << col_midx);
-        for (; i < DIM; ++i) {
-            if (row_midx[i] < col_midx[i]) {
-                ++col_midx;
-                break;
-            } else if (row_midx[i] > col_midx[i]) {
-                ++row_midx;
-                break;
-            }
-        }
-        if (i < DIM - 1)
-            continue;
-        //DEBUG("accessing " << row_midx.inc().wrappedIdx() << ", " << col_midx.inc().wrappedIdx());
-        tf(row_midx.inc().wrappedIdx(), col_midx.inc().wrappedIdx()) = 1.0;
-        ++row_midx;
-        ++col_midx;
-    }
+    BRY_PROBE_BYTES(_BRY::operatorBytes(tf));
+
+    // Every term shared by both degrees maps to itself, so walk the shared terms with the row and column wrapping in lockstep
+    std::array<bry_int_t, DIM> shared_bounds;
+    shared_bounds.fill(std::min(from_deg, to_deg) + 1);
+    auto row_midx = smIdxB<DIM>(shared_bounds, to_deg + 1);
+    auto col_midx = smIdxB<DIM>(shared_bounds, from_deg + 1);
+    for (; !row_midx.last(); ++row_midx, ++col_midx)
+        tf(row_midx.wrappedIdx(), col_midx.wrappedIdx()) = 1.0;
     return tf;
-}
\ No newline at end of file
+}
+
+template <std::size_t DIM>
+static std::shared_ptr<const BRY::Matrix> BRY::cachedDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg) {
+    OperatorKey key{OperatorType::DegreeChangeMatrix, DIM, from_deg, to_deg - from_deg};
+    return OperatorCache::instance().fetch<Matrix>(key, [&] {
+        return makeDegreeChangeTransform<DIM>(from_deg, to_deg);
+    });
+}
+
+template <std::size_t DIM>
+static BRY::SparseMatrix BRY::makeSparseDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg) {
+    BRY_PROBE(SparseDegreeChangeMatrix, pow(from_deg + 1, DIM));
+    std::array<bry_int_t, DIM> shared_bounds;
+    shared_bounds.fill(std::min(from_deg, to_deg) + 1);
+
+    std::vector<Eigen::Triplet<bry_float_t>> triplets;
+    triplets.reserve(pow(shared_bounds[0], DIM));
+    auto row_midx = smIdxB<DIM>(shared_bounds, to_deg + 1);
+    auto col_midx = smIdxB<DIM>(shared_bounds, from_deg + 1);
+    for (; !row_midx.last(); ++row_midx, ++col_midx)
+        triplets.emplace_back(row_midx.wrappedIdx(), col_midx.wrappedIdx(), 1.0);
+
+    SparseMatrix tf(pow(to_deg + 1, DIM), pow(from_deg + 1, DIM));
+    tf.setFromTriplets(triplets.begin(), triplets.end());
+    BRY_PROBE_BYTES(_BRY::operatorBytes(tf));
+    return tf;
+}
+
+template <std::size_t DIM>
+static std::shared_ptr<const BRY::SparseMatrix> BRY::cachedSparseDegreeChangeTransform(bry_int_t from_deg, bry_int_t to_deg) {
+    OperatorKey key{OperatorType::SparseDegreeChangeMatrix, DIM, from_deg, to_deg - from_deg};
+    return OperatorCache::instance().fetch<SparseMatrix>(key, [&] {
+        return makeSparseDegreeChangeTransform<DIM>(from_deg, to_deg);
+    });
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "OperatorCache.h"
+
+#include "lemon/Logging.h"
+
+#include <functional>
+
+namespace _BRY {
+
+BRY_INL std::size_t operatorBytes(const BRY::Matrix& matrix) {
+    return sizeof(BRY::Matrix) + matrix.size() * sizeof(BRY::bry_float_t);
+}
+
+BRY_INL std::size_t operatorBytes(const BRY::SparseMatrix& matrix) {
+    return sizeof(BRY::SparseMatrix) + matrix.nonZeros() * (sizeof(BRY::bry_float_t) + sizeof(BRY::SparseMatrix::StorageIndex)) 
+        + (matrix.outerSize() + 1) * sizeof(BRY::SparseMatrix::StorageIndex);
+}
+
+template <std::size_t DIM>
+std::size_t operatorBytes(const BRY::KroneckerTransform<DIM>& transform) {
+    std::size_t bytes = sizeof(BRY::KroneckerTransform<DIM>);
+    for (std::size_t d = 0; d < DIM; ++d)
+        bytes += transform.factor(d).size() * sizeof(BRY::bry_float_t);
+    return bytes;
+}
+
+}
+
+BRY::OperatorCache& BRY::OperatorCache::instance() {
+    static OperatorCache cache(BRY_OPERATOR_CACHE_CAPACITY);
+    return cache;
+}
+
+BRY::OperatorCache::OperatorCache(std::size_t capacity)
+    : m_capacity(capacity)
+{}
+
+template <typename T, typename BUILDER>
+std::shared_ptr<const T> BRY::OperatorCache::fetch(const OperatorKey& key, BUILDER&& build) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            ++m_hits;
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            return std::static_pointer_cast<const T>(it->second->op);
+        }
+        ++m_misses;
+    }
+
+    // Build without holding the lock so that other operators can be fetched concurrently
+    std::shared_ptr<const T> op = std::make_shared<const T>(build());
+    std::size_t bytes = _BRY::operatorBytes(*op);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Another thread may have built the same operator in the mean time
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+        return std::static_pointer_cast<const T>(it->second->op);
+
+    // Operators that are larger than the whole cache are not stored
+    if (bytes > m_capacity)
+        return op;
+
+    evictTo(m_capacity - bytes);
+    m_lru.push_front(Entry{key, op, bytes});
+    m_entries[key] = m_lru.begin();
+    m_bytes += bytes;
+    return op;
+}
+
+void BRY::OperatorCache::setCapacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evictTo(m_capacity);
+}
+
+void BRY::OperatorCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lru.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+BRY::OperatorCache::Statistics BRY::OperatorCache::statistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.evictions = m_evictions;
+    stats.entries = m_entries.size();
+    stats.bytes = m_bytes;
+    stats.capacity = m_capacity;
+    return stats;
+}
+
+void BRY::OperatorCache::resetStatistics() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
+
+void BRY::OperatorCache::evictTo(std::size_t capacity) {
+    while (m_bytes > capacity && !m_lru.empty()) {
+        const Entry& entry = m_lru.back();
+        m_bytes -= entry.bytes;
+        m_entries.erase(entry.key);
+        m_lru.pop_back();
+        ++m_evictions;
+    }
+}
+
+std::size_t BRY::OperatorCache::KeyHash::operator()(const OperatorKey& key) const {
+    std::size_t h = std::hash<int>{}(static_cast<int>(key.type));
+    auto combine = [&h] (std::size_t v) {
+        h ^= v + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+    };
+    combine(key.dim);
+    combine(std::hash<bry_int_t>{}(key.degree));
+    combine(std::hash<bry_int_t>{}(key.degree_increase));
+    return h;
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "PolynomialExpression.h"
+#include "MultiIndex.h"
+#include "Operations.h"
+
+/* Polynomial Expression */
+
+template <std::size_t DIM, typename DERIVED>
+const DERIVED& BRY::PolynomialExpression<DIM, DERIVED>::derived() const {
+    return static_cast<const DERIVED&>(*this);
+}
+
+template <std::size_t DIM, typename DERIVED>
+BRY::bry_int_t BRY::PolynomialExpression<DIM, DERIVED>::degree() const {
+    return derived().degree();
+}
+
+template <std::size_t DIM, typename DERIVED>
+Eigen::Tensor<BRY::bry_float_t, DIM> BRY::PolynomialExpression<DIM, DERIVED>::tensor() const {
+    bry_int_t n = derived().degree() + 1;
+    Eigen::Tensor<bry_float_t, DIM> tensor = _BRY::makeTensor<DIM>(makeUniformArray<bry_int_t, DIM>(n));
+    tensor.setZero();
+
+    // Sweep over the first coefficient of each run along dimension 0
+    std::array<bry_int_t, DIM> run_bounds = makeUniformArray<bry_int_t, DIM>(n);
+    run_bounds[0] = 1;
+    for (const auto& midx : smIdxRange<DIM>(run_bounds, n))
+        derived().accumulate(tensor.data() + midx.wrappedIdx(), midx.idx(), 1.0);
+    return tensor;
+}
+
+template <std::size_t DIM, typename DERIVED>
+BRY::Polynomial<DIM, BRY::Basis::Power> BRY::PolynomialExpression<DIM, DERIVED>::eval() const {
+    return Polynomial<DIM, Basis::Power>(tensor());
+}
+
+/* Polynomial Term */
+
+template <std::size_t DIM>
+BRY::PolynomialTerm<DIM>::PolynomialTerm(const Polynomial<DIM, Basis::Power>& p)
+    : m_p(p)
+{}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::PolynomialTerm<DIM>::degree() const {
+    return m_p.degree();
+}
+
+template <std::size_t DIM>
+void BRY::PolynomialTerm<DIM>::accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const {
+    bry_int_t n = m_p.degree() + 1;
+    bry_int_t offset = 0;
+    bry_int_t stride = n;
+    for (std::size_t d = 1; d < DIM; ++d) {
+        // The run is outside of the operand (zero coefficients)
+        if (idx[d] >= n)
+            return;
+        offset += idx[d] * stride;
+        stride *= n;
+    }
+
+    const bry_float_t* src = m_p.tensor().data() + offset;
+    for (bry_int_t i = 0; i < n; ++i)
+        run[i] += weight * src[i];
+}
+
+/* Polynomial Constant */
+
+template <std::size_t DIM>
+BRY::PolynomialConstant<DIM>::PolynomialConstant(bry_float_t value)
+    : m_value(value)
+{}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::PolynomialConstant<DIM>::degree() const {
+    return 0;
+}
+
+template <std::size_t DIM>
+void BRY::PolynomialConstant<DIM>::accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const {
+    for (std::size_t d = 1; d < DIM; ++d) {
+        if (idx[d] != 0)
+            return;
+    }
+    run[0] += weight * m_value;
+}
+
+/* Polynomial Scaled */
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR>::PolynomialScaled(const EXPR& expr, bry_float_t scalar)
+    : m_expr(expr)
+    , m_scalar(scalar)
+{}
+
+template <std::size_t DIM, typename EXPR>
+BRY::bry_int_t BRY::PolynomialScaled<DIM, EXPR>::degree() const {
+    return m_expr.degree();
+}
+
+template <std::size_t DIM, typename EXPR>
+void BRY::PolynomialScaled<DIM, EXPR>::accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const {
+    m_expr.accumulate(run, idx, m_scalar * weight);
+}
+
+/* Polynomial Sum */
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialSum<DIM, LHS, RHS>::PolynomialSum(const LHS& lhs, const RHS& rhs)
+    : m_lhs(lhs)
+    , m_rhs(rhs)
+{}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::bry_int_t BRY::PolynomialSum<DIM, LHS, RHS>::degree() const {
+    return std::max(m_lhs.degree(), m_rhs.degree());
+}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+void BRY::PolynomialSum<DIM, LHS, RHS>::accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const {
+    m_lhs.accumulate(run, idx, weight);
+    m_rhs.accumulate(run, idx, weight);
+}
+
+/* Polynomial Difference */
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialDifference<DIM, LHS, RHS>::PolynomialDifference(const LHS& lhs, const RHS& rhs)
+    : m_lhs(lhs)
+    , m_rhs(rhs)
+{}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::bry_int_t BRY::PolynomialDifference<DIM, LHS, RHS>::degree() const {
+    return std::max(m_lhs.degree(), m_rhs.degree());
+}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+void BRY::PolynomialDifference<DIM, LHS, RHS>::accumulate(bry_float_t* run, const std::array<bry_int_t, DIM>& idx, bry_float_t weight) const {
+    m_lhs.accumulate(run, idx, weight);
+    m_rhs.accumulate(run, idx, -weight);
+}
+
+template <std::size_t DIM>
+BRY::PolynomialTerm<DIM> BRY::lazy(const Polynomial<DIM, Basis::Power>& p) {
+    return PolynomialTerm<DIM>(p);
+}
+
+/* Operators */
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialSum<DIM, LHS, RHS> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialSum<DIM, LHS, RHS>(lhs.derived(), rhs.derived());
+}
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialSum<DIM, LHS, BRY::PolynomialTerm<DIM>> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::Polynomial<DIM, BRY::Basis::Power>& p) {
+    return BRY::PolynomialSum<DIM, LHS, BRY::PolynomialTerm<DIM>>(lhs.derived(), BRY::PolynomialTerm<DIM>(p));
+}
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialSum<DIM, BRY::PolynomialTerm<DIM>, RHS> operator+(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialSum<DIM, BRY::PolynomialTerm<DIM>, RHS>(BRY::PolynomialTerm<DIM>(p), rhs.derived());
+}
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialSum<DIM, LHS, BRY::PolynomialConstant<DIM>> operator+(const BRY::PolynomialExpression<DIM, LHS>& lhs, BRY::bry_float_t scalar) {
+    return BRY::PolynomialSum<DIM, LHS, BRY::PolynomialConstant<DIM>>(lhs.derived(), BRY::PolynomialConstant<DIM>(scalar));
+}
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialSum<DIM, BRY::PolynomialConstant<DIM>, RHS> operator+(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialSum<DIM, BRY::PolynomialConstant<DIM>, RHS>(BRY::PolynomialConstant<DIM>(scalar), rhs.derived());
+}
+
+template <std::size_t DIM, typename LHS, typename RHS>
+BRY::PolynomialDifference<DIM, LHS, RHS> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialDifference<DIM, LHS, RHS>(lhs.derived(), rhs.derived());
+}
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialTerm<DIM>> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, const BRY::Polynomial<DIM, BRY::Basis::Power>& p) {
+    return BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialTerm<DIM>>(lhs.derived(), BRY::PolynomialTerm<DIM>(p));
+}
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialDifference<DIM, BRY::PolynomialTerm<DIM>, RHS> operator-(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialDifference<DIM, BRY::PolynomialTerm<DIM>, RHS>(BRY::PolynomialTerm<DIM>(p), rhs.derived());
+}
+
+template <std::size_t DIM, typename LHS>
+BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialConstant<DIM>> operator-(const BRY::PolynomialExpression<DIM, LHS>& lhs, BRY::bry_float_t scalar) {
+    return BRY::PolynomialDifference<DIM, LHS, BRY::PolynomialConstant<DIM>>(lhs.derived(), BRY::PolynomialConstant<DIM>(scalar));
+}
+
+template <std::size_t DIM, typename RHS>
+BRY::PolynomialDifference<DIM, BRY::PolynomialConstant<DIM>, RHS> operator-(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, RHS>& rhs) {
+    return BRY::PolynomialDifference<DIM, BRY::PolynomialConstant<DIM>, RHS>(BRY::PolynomialConstant<DIM>(scalar), rhs.derived());
+}
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator-(const BRY::PolynomialExpression<DIM, EXPR>& expr) {
+    return BRY::PolynomialScaled<DIM, EXPR>(expr.derived(), -1.0);
+}
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator*(BRY::bry_float_t scalar, const BRY::PolynomialExpression<DIM, EXPR>& expr) {
+    return BRY::PolynomialScaled<DIM, EXPR>(expr.derived(), scalar);
+}
+
+template <std::size_t DIM, typename EXPR>
+BRY::PolynomialScaled<DIM, EXPR> operator*(const BRY::PolynomialExpression<DIM, EXPR>& expr, BRY::bry_float_t scalar) {
+    return BRY::PolynomialScaled<DIM, EXPR>(expr.derived(), scalar);
+}
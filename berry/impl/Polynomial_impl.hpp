@@ -3,43 +3,212 @@
 #include "Polynomial.h"
 #include "MultiIndex.h"
 #include "Operations.h"
+#include "Multiplication.h"
 
 #include "lemon/Logging.h"
 
+#include <algorithm>
 #include <cmath>
 #include <math.h>
+#include <numeric>
 #include <stdexcept>
 
 namespace _BRY {
     template <std::size_t DIM>
     Eigen::Tensor<BRY::bry_float_t, DIM> expandToMatchSize(const Eigen::Tensor<BRY::bry_float_t, DIM>& tensor, BRY::bry_int_t sz) {
-        #ifdef BRY_ENABLE_BOUNDS_CHECK
-            ASSERT(tensor.dimension(0) <= sz, "Input tensor is not smaller than desired size");
-        #endif
+        BRY_ASSERT(tensor.dimension(0) <= sz, "Input tensor is not smaller than desired size");
 
-        if (tensor.dimension(0) == sz)
-            return tensor;
+        Eigen::Tensor<BRY::bry_float_t, DIM> expanded = makeTensor<DIM>(BRY::makeUniformArray<BRY::bry_int_t, DIM>(sz));
+        if (tensor.dimension(0) == sz) {
+            expanded = tensor;
+            return expanded;
+        }
+
+        // Copy into the leading block instead of padding to avoid a temporary
+        expanded.setZero();
+        expanded.slice(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0), tensor.dimensions()) = tensor;
+        return expanded;
+    }
+
+    /// @brief Apply the affine change of variables `x_d = shift[d] + scale[d] * t_d` to a (column-major) power basis coefficient 
+    /// tensor with `n` coefficients along each dimension
+    template <std::size_t DIM>
+    void reparameterizeCoefficients(BRY::bry_float_t* coeffs, BRY::bry_int_t n, const std::array<BRY::bry_float_t, DIM>& shift, const std::array<BRY::bry_float_t, DIM>& scale) {
+        BRY::bry_int_t size = BRY::pow(n, DIM);
+        BRY::bry_int_t stride = 1;
+        for (std::size_t d = 0; d < DIM; ++d) {
+            BRY::bry_int_t n_outer = size / (stride * n);
+
+            // Taylor shift p(x + shift) by repeated synthetic division, sweeping every fiber of the mode at once so that the innermost 
+            // loop runs over contiguous coefficients
+            if (shift[d] != 0.0) {
+                for (BRY::bry_int_t outer = 0; outer < n_outer; ++outer) {
+                    BRY::bry_float_t* block = coeffs + outer * stride * n;
+                    for (BRY::bry_int_t i = 0; i < n - 1; ++i) {
+                        for (BRY::bry_int_t j = n - 2; j >= i; --j) {
+                            BRY::bry_float_t* dst = block + j * stride;
+                            const BRY::bry_float_t* src = dst + stride;
+                            for (BRY::bry_int_t inner = 0; inner < stride; ++inner)
+                                dst[inner] += shift[d] * src[inner];
+                        }
+                    }
+                }
+            }
 
-        std::array<std::pair<BRY::bry_int_t, BRY::bry_int_t>, DIM> paddings;
-        for (std::pair<BRY::bry_int_t, BRY::bry_int_t>& pads : paddings) {
-            pads.first = 0;
-            pads.second = sz - tensor.dimension(0);
+            // Scale the coefficients of x_d^k by scale^k
+            if (scale[d] != 1.0) {
+                for (BRY::bry_int_t outer = 0; outer < n_outer; ++outer) {
+                    BRY::bry_float_t* block = coeffs + outer * stride * n;
+                    BRY::bry_float_t factor = scale[d];
+                    for (BRY::bry_int_t k = 1; k < n; ++k) {
+                        BRY::bry_float_t* slab = block + k * stride;
+                        for (BRY::bry_int_t inner = 0; inner < stride; ++inner)
+                            slab[inner] *= factor;
+                        factor *= scale[d];
+                    }
+                }
+            }
+            stride *= n;
         }
+    }
+
+    /// @brief Apply a (dense or sparse) vectorized transformation matrix to the coefficients of a polynomial
+    template <std::size_t DIM, BRY::Basis TO_BASIS, BRY::Basis FROM_BASIS, typename MATRIX_T>
+    BRY::Polynomial<DIM, TO_BASIS> transformVectorized(const BRY::Polynomial<DIM, FROM_BASIS>& p, const MATRIX_T& transform_matrix) {
+        BRY::bry_int_t new_size = static_cast<BRY::bry_int_t>(std::pow(transform_matrix.rows(), 1.0 / static_cast<BRY::bry_float_t>(DIM)));
+        if (BRY::pow(new_size, DIM) < transform_matrix.rows())
+            new_size += 1;
+
+        Eigen::Tensor<BRY::bry_float_t, DIM> tensor = makeTensor<DIM>(BRY::makeUniformArray<BRY::bry_int_t, DIM>(new_size));
+        tensor.setZero();
+
+        Eigen::Map<const BRY::Vector> p_vec(p.tensor().data(), p.nMonomials());
+        Eigen::Map<BRY::Vector> p_vec_tf(tensor.data(), transform_matrix.rows());
+
+        p_vec_tf = transform_matrix * p_vec;
+
+        return BRY::Polynomial<DIM, TO_BASIS>(std::move(tensor));
+    }
+
+    /// @brief Values of a block of points (one SIMD lane per point)
+    using EvalBlock = Eigen::Array<BRY::bry_float_t, BRY_EVAL_BLOCK_SIZE, 1>;
+
+    /// @brief Nested Horner's method on a block of points for the sub-tensor of dimensions `0, ..., D`
+    /// @param coeffs Start of the sub-tensor
+    /// @param n Size of each dimension (degree + 1)
+    /// @param stride Stride of dimension `D` (n^D)
+    /// @param x Structure-of-arrays block of points
+    template <std::size_t D, std::size_t DIM>
+    inline EvalBlock hornerBlock(const BRY::bry_float_t* coeffs, BRY::bry_int_t n, BRY::bry_int_t stride, const std::array<EvalBlock, DIM>& x) {
+        if constexpr (D == 0) {
+            EvalBlock acc = EvalBlock::Constant(coeffs[n - 1]);
+            for (BRY::bry_int_t k = n - 2; k >= 0; --k)
+                acc = acc * x[0] + coeffs[k];
+            return acc;
+        } else {
+            BRY::bry_int_t sub_stride = stride / n;
+            EvalBlock acc = hornerBlock<D - 1, DIM>(coeffs + (n - 1) * stride, n, sub_stride, x);
+            for (BRY::bry_int_t k = n - 2; k >= 0; --k)
+                acc = acc * x[D] + hornerBlock<D - 1, DIM>(coeffs + k * stride, n, sub_stride, x);
+            return acc;
+        }
+    }
+
+    /// @brief Evaluate a 1-D Bernstein polynomial using de Casteljau's algorithm
+    /// @param b Bernstein coefficients (overwritten)
+    /// @param n Number of coefficients (degree + 1)
+    /// @param t Point in [0, 1]
+    inline BRY::bry_float_t deCasteljau(BRY::bry_float_t* b, BRY::bry_int_t n, BRY::bry_float_t t) {
+        BRY::bry_float_t one_minus_t = 1.0 - t;
+        for (BRY::bry_int_t r = 1; r < n; ++r) {
+            for (BRY::bry_int_t i = 0; i < n - r; ++i)
+                b[i] = one_minus_t * b[i] + t * b[i + 1];
+        }
+        return b[0];
+    }
+
+    /// @brief Nested de Casteljau's algorithm on a block of points for the sub-tensor of dimensions `0, ..., D`
+    /// @param coeffs Start of the sub-tensor
+    /// @param n Size of each dimension (degree + 1)
+    /// @param stride Stride of dimension `D` (n^D)
+    /// @param x Structure-of-arrays block of points
+    /// @param scratch Buffer of `DIM * n` blocks, dimension `D` works in the `D`-th set of `n` blocks
+    template <std::size_t D, std::size_t DIM>
+    inline EvalBlock deCasteljauBlock(const BRY::bry_float_t* coeffs, BRY::bry_int_t n, BRY::bry_int_t stride, const std::array<EvalBlock, DIM>& x, EvalBlock* scratch) {
+        EvalBlock* b = scratch + D * n;
+        if constexpr (D == 0) {
+            for (BRY::bry_int_t k = 0; k < n; ++k)
+                b[k] = EvalBlock::Constant(coeffs[k]);
+        } else {
+            BRY::bry_int_t sub_stride = stride / n;
+            for (BRY::bry_int_t k = 0; k < n; ++k)
+                b[k] = deCasteljauBlock<D - 1, DIM>(coeffs + k * stride, n, sub_stride, x, scratch);
+        }
+
+        EvalBlock one_minus_t = 1.0 - x[D];
+        for (BRY::bry_int_t r = 1; r < n; ++r) {
+            for (BRY::bry_int_t i = 0; i < n - r; ++i)
+                b[i] = one_minus_t * b[i] + x[D] * b[i + 1];
+        }
+        return b[0];
+    }
+
+    /// @brief Evaluate each block of points using a block kernel, optionally distributing the blocks across a scheduler
+    /// @param kernel Callable with signature `EvalBlock(const std::array<EvalBlock, DIM>&)`
+    template <std::size_t DIM, typename KERNEL>
+    BRY::Vector evaluateBlocks(const Eigen::Matrix<BRY::bry_float_t, DIM, Eigen::Dynamic>& points, BRY::TaskScheduler* scheduler, const KERNEL& kernel) {
+        constexpr BRY::bry_int_t block_size = BRY_EVAL_BLOCK_SIZE;
+        BRY::bry_int_t n_points = points.cols();
+        BRY::bry_int_t n_blocks = (n_points + block_size - 1) / block_size;
+
+        BRY::Vector values(n_points);
+
+        auto evaluateBlock = [&] (BRY::bry_int_t b) {
+            BRY::bry_int_t offset = b * block_size;
+            BRY::bry_int_t lanes = std::min(block_size, n_points - offset);
+
+            // Transpose the block of points into structure-of-arrays, padding the unused lanes
+            std::array<EvalBlock, DIM> x;
+            for (std::size_t d = 0; d < DIM; ++d) {
+                for (BRY::bry_int_t j = 0; j < lanes; ++j)
+                    x[d][j] = points(d, offset + j);
+                for (BRY::bry_int_t j = lanes; j < block_size; ++j)
+                    x[d][j] = 0.0;
+            }
+
+            EvalBlock block_values = kernel(x);
+            values.segment(offset, lanes) = block_values.head(lanes).matrix();
+        };
 
-        return tensor.pad(paddings);
+        if (!scheduler) {
+            for (BRY::bry_int_t b = 0; b < n_blocks; ++b)
+                evaluateBlock(b);
+        } else {
+            // A few tasks per thread so that stealing can balance the load
+            BRY::bry_int_t grain = std::max<BRY::bry_int_t>(1, n_blocks / (4 * scheduler->nThreads()));
+            scheduler->parallelFor(0, n_blocks, evaluateBlock, grain);
+        }
+        return values;
     }
 }
 
 template <std::size_t DIM, BRY::Basis BASIS>
 BRY::Polynomial<DIM, BASIS>::Polynomial(bry_int_t degree)
-    : m_tensor(makeUniformArray<bry_int_t, DIM>(degree + 1))
+    : m_tensor(_BRY::makeTensor<DIM>(makeUniformArray<bry_int_t, DIM>(degree + 1)))
 {
     m_tensor.setZero();
 }
 
 template <std::size_t DIM, BRY::Basis BASIS>
 BRY::Polynomial<DIM, BASIS>::Polynomial(const Eigen::Tensor<bry_float_t, DIM>& tensor) 
-    : m_tensor(tensor)
+    : m_tensor(_BRY::makeTensor<DIM>(tensor.dimensions()))
+{
+    m_tensor = tensor;
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>::Polynomial(const Polynomial& other) 
+    : Polynomial(other.m_tensor)
 {}
 
 template <std::size_t DIM, BRY::Basis BASIS>
@@ -59,11 +228,24 @@ BRY::Polynomial<DIM, BASIS>::Polynomial(const Vector& vector)
         throw std::invalid_argument("Input vector dimension mismatch");
     }
 
-    m_tensor = Eigen::Tensor<bry_float_t, DIM>(makeUniformArray<bry_int_t, DIM>(new_size));
+    m_tensor = _BRY::makeTensor<DIM>(makeUniformArray<bry_int_t, DIM>(new_size));
     Eigen::Map<Vector> p_vec(m_tensor.data(), vector.size());
     p_vec = vector;
 }
 
+template <std::size_t DIM, BRY::Basis BASIS>
+template <typename DERIVED>
+BRY::Polynomial<DIM, BASIS>::Polynomial(const PolynomialExpression<DIM, DERIVED>& expr)
+    : m_tensor(expr.tensor())
+{
+    static_assert(BASIS == Basis::Power, "Polynomial expressions are only supported in the power basis");
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>::~Polynomial() {
+    _BRY::recycleTensor<DIM>(std::move(m_tensor));
+}
+
 template <std::size_t DIM, BRY::Basis BASIS>
 BRY::bry_int_t BRY::Polynomial<DIM, BASIS>::degree() const {
     return m_tensor.dimension(0) - 1;
@@ -105,7 +287,7 @@ BRY::bry_float_t BRY::Polynomial<DIM, BASIS>::operator()(FLTS ... x) const {
 
 template <std::size_t DIM, BRY::Basis BASIS>
 BRY::bry_float_t BRY::Polynomial<DIM, BASIS>::operator()(const std::array<bry_float_t, DIM>& x) const {
-    static_assert(BASIS == BRY::Basis::Power, "Evaluation of polynomials not in Power basis currently not supported");
+    BRY_PROBE(Evaluate, m_tensor.size());
     if constexpr (BASIS == BRY::Basis::Power) {
 
         // Used to store temporary sums of each x variable multiplier
@@ -143,6 +325,17 @@ BRY::bry_float_t BRY::Polynomial<DIM, BASIS>::operator()(const std::array<bry_fl
         x_cache[0] = *m_tensor.data();
         return std::accumulate(x_cache.begin(), x_cache.end(), 0.0);
     } else {
+        // Tensor de Casteljau: collapse one dimension at a time, each fiber along the dimension reduces to a single value
+        bry_int_t n = degree() + 1;
+        std::vector<bry_float_t> buffer(m_tensor.data(), m_tensor.data() + m_tensor.size());
+
+        bry_int_t n_fibers = m_tensor.size();
+        for (std::size_t d = 0; d < DIM; ++d) {
+            n_fibers /= n;
+            for (bry_int_t f = 0; f < n_fibers; ++f)
+                buffer[f] = _BRY::deCasteljau(buffer.data() + f * n, n, x[d]);
+        }
+        return buffer[0];
     }
 }
 
@@ -154,55 +347,158 @@ BRY::bry_float_t BRY::Polynomial<DIM, BASIS>::operator()(const Eigen::Vector<bry
 }
 
 template <std::size_t DIM, BRY::Basis BASIS>
-BRY::Polynomial<DIM, BASIS> BRY::Polynomial<DIM, BASIS>::derivative(bry_int_t dx_idx) const {
-    #ifdef BRY_ENABLE_BOUNDS_CHECK
-        ASSERT(dx_idx < DIM && dx_idx >= 0, "Derivative idx out of bounds");
-    #endif
-
-    if (degree() == 0) {
-        Eigen::Tensor<bry_float_t, DIM> t(m_tensor.dimensions());
-        t.setZero();
-        return Polynomial<DIM, BASIS>(std::move(t));
+BRY::Vector BRY::Polynomial<DIM, BASIS>::evaluate(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points) const {
+    return evaluateBatch(points, nullptr);
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Vector BRY::Polynomial<DIM, BASIS>::evaluate(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points, TaskScheduler& scheduler) const {
+    return evaluateBatch(points, &scheduler);
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Vector BRY::Polynomial<DIM, BASIS>::evaluateBatch(const Eigen::Matrix<bry_float_t, DIM, Eigen::Dynamic>& points, TaskScheduler* scheduler) const {
+    BRY_PROBE(EvaluateBatch, m_tensor.size());
+    BRY_PROBE_BYTES(points.cols() * sizeof(bry_float_t));
+    bry_int_t n = degree() + 1;
+    bry_int_t top_stride = pow(n, DIM - 1);
+    const bry_float_t* coeffs = m_tensor.data();
+    if constexpr (BASIS == BRY::Basis::Power) {
+        return _BRY::evaluateBlocks<DIM>(points, scheduler, [&] (const std::array<_BRY::EvalBlock, DIM>& x) {
+            return _BRY::hornerBlock<DIM - 1, DIM>(coeffs, n, top_stride, x);
+        });
+    } else {
+        return _BRY::evaluateBlocks<DIM>(points, scheduler, [&] (const std::array<_BRY::EvalBlock, DIM>& x) {
+            thread_local std::vector<_BRY::EvalBlock> scratch;
+            scratch.resize(DIM * n);
+            return _BRY::deCasteljauBlock<DIM - 1, DIM>(coeffs, n, top_stride, x, scratch.data());
+        });
     }
+}
 
-    Eigen::Tensor<bry_float_t, DIM> increment_tensor = makeIncrementTensor(m_tensor.dimensions(), dx_idx, 0);
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS> BRY::Polynomial<DIM, BASIS>::derivative(bry_int_t dx_idx) const {
+    Polynomial<DIM, BASIS> derivative_p(*this);
+    derivative_p.derivativeInPlace(dx_idx);
+    return derivative_p;
+}
 
-    // Multiply each coefficient in the tensor by the previous exponent (power rule)
-    Eigen::Tensor<bry_float_t, DIM> power_coefficient_tensor = m_tensor * increment_tensor;
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS> BRY::Polynomial<DIM, BASIS>::liftDegree(bry_int_t raised_deg) const {
+    BRY_ASSERT(raised_deg >= degree(), "Raised degree is smaller than current degree");
+    BRY_PROBE(LiftDegree, m_tensor.size());
+    BRY_PROBE_BYTES(pow(raised_deg + 1, DIM) * sizeof(bry_float_t));
+    return Polynomial<DIM, BASIS>(_BRY::expandToMatchSize<DIM>(m_tensor, raised_deg + 1));
+}
 
-    std::array<bry_int_t, DIM> offsets = makeUniformArray<bry_int_t, DIM>(0);
-    // Offset the tensor along the differential index to remove all of the 'constant' terms
-    offsets[dx_idx] = 1;
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>& BRY::Polynomial<DIM, BASIS>::operator+=(const Polynomial& p) {
+    BRY_PROBE(Add, m_tensor.size() + p.m_tensor.size());
+    static_assert(BASIS == Basis::Power, "In-place addition is only supported in the power basis");
+    if (p.degree() > degree()) {
+        // Grow to the larger degree, and add the current coefficients into the leading block
+        Eigen::Tensor<bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p.m_tensor.dimensions());
+        new_tensor = p.m_tensor;
+        new_tensor.slice(makeUniformArray<bry_int_t, DIM>(0), m_tensor.dimensions()) += m_tensor;
+        std::swap(m_tensor, new_tensor);
+        _BRY::recycleTensor<DIM>(std::move(new_tensor));
+        BRY_PROBE_BYTES(m_tensor.size() * sizeof(bry_float_t));
+    } else {
+        m_tensor.slice(makeUniformArray<bry_int_t, DIM>(0), p.m_tensor.dimensions()) += p.m_tensor;
+    }
+    return *this;
+}
 
-    std::array<bry_int_t, DIM> extents = makeUniformArray<bry_int_t, DIM>(degree() + 1);
-    // Along the differential dimension, only keep the remaining rows after deleting the first
-    extents[dx_idx] -= 1;
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>& BRY::Polynomial<DIM, BASIS>::operator-=(const Polynomial& p) {
+    BRY_PROBE(Subtract, m_tensor.size() + p.m_tensor.size());
+    static_assert(BASIS == Basis::Power, "In-place subtraction is only supported in the power basis");
+    if (p.degree() > degree()) {
+        Eigen::Tensor<bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p.m_tensor.dimensions());
+        new_tensor = -p.m_tensor;
+        new_tensor.slice(makeUniformArray<bry_int_t, DIM>(0), m_tensor.dimensions()) += m_tensor;
+        std::swap(m_tensor, new_tensor);
+        _BRY::recycleTensor<DIM>(std::move(new_tensor));
+        BRY_PROBE_BYTES(m_tensor.size() * sizeof(bry_float_t));
+    } else {
+        m_tensor.slice(makeUniformArray<bry_int_t, DIM>(0), p.m_tensor.dimensions()) -= p.m_tensor;
+    }
+    return *this;
+}
 
-    // Erase all the constant terms and make a tensor of dim-1 along dx_idx
-    Eigen::Tensor<bry_float_t, DIM> derivative_tensor = power_coefficient_tensor.slice(offsets, extents);
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>& BRY::Polynomial<DIM, BASIS>::operator+=(bry_float_t scalar) {
+    static_assert(BASIS == Basis::Power, "In-place constant addition is only supported in the power basis");
+    BRY_PROBE(Add, m_tensor.size());
+    *m_tensor.data() += scalar;
+    return *this;
+}
 
-    std::array<std::pair<bry_int_t, bry_int_t>, DIM> paddings;
-    for (std::size_t d = 0; d < DIM; ++d) {
-        if (d == dx_idx) {
-            paddings[d] = std::make_pair(0, 1);
-        } else {
-            paddings[d] = std::make_pair(0, 0);
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>& BRY::Polynomial<DIM, BASIS>::operator-=(bry_float_t scalar) {
+    static_assert(BASIS == Basis::Power, "In-place constant subtraction is only supported in the power basis");
+    BRY_PROBE(Subtract, m_tensor.size());
+    *m_tensor.data() -= scalar;
+    return *this;
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS>& BRY::Polynomial<DIM, BASIS>::operator*=(bry_float_t scalar) {
+    BRY_PROBE(Scale, m_tensor.size());
+    Eigen::Map<Vector> coefficients(m_tensor.data(), m_tensor.size());
+    coefficients *= scalar;
+    return *this;
+}
+
+template <std::size_t DIM, BRY::Basis BASIS>
+void BRY::Polynomial<DIM, BASIS>::derivativeInPlace(bry_int_t dx_idx) {
+    BRY_ASSERT(dx_idx < static_cast<bry_int_t>(DIM) && dx_idx >= 0, "Derivative idx out of bounds");
+    BRY_PROBE(Derivative, m_tensor.size());
+
+    // View the tensor as (stride x n x outer) blocks, where the middle index is the exponent of dx_idx. Multiply each coefficient by 
+    // its exponent (power rule) and shift it over by one (reducing the exponent by 1). Shifting in increasing exponent order only 
+    // overwrites coefficients that were already read
+    bry_int_t n = degree() + 1;
+    bry_int_t stride = pow(n, dx_idx);
+    bry_int_t outer = m_tensor.size() / (stride * n);
+    bry_float_t* data = m_tensor.data();
+    for (bry_int_t o = 0; o < outer; ++o) {
+        bry_int_t block = o * stride * n;
+        for (bry_int_t k = 1; k < n; ++k) {
+            bry_float_t exponent = static_cast<bry_float_t>(k);
+            for (bry_int_t j = 0; j < stride; ++j)
+                data[block + (k - 1) * stride + j] = exponent * data[block + k * stride + j];
         }
+        std::fill_n(data + block + (n - 1) * stride, stride, 0.0);
     }
+}
 
-    // Add zeros on the end the tensor so that it returns to original degree (effectively)
-    // shifting the coefficients over (reducing the exponent by 1)
-    Eigen::Tensor<bry_float_t, DIM> derivative_tensor_orig_deg = derivative_tensor.pad(paddings);
+template <std::size_t DIM, BRY::Basis BASIS>
+void BRY::Polynomial<DIM, BASIS>::liftDegreeInPlace(bry_int_t raised_deg) {
+    BRY_ASSERT(raised_deg >= degree(), "Raised degree is smaller than current degree");
+    if (raised_deg == degree())
+        return;
+
+    BRY_PROBE(LiftDegree, m_tensor.size());
+    BRY_PROBE_BYTES(pow(raised_deg + 1, DIM) * sizeof(bry_float_t));
+    Eigen::Tensor<bry_float_t, DIM> new_tensor = _BRY::expandToMatchSize<DIM>(m_tensor, raised_deg + 1);
+    std::swap(m_tensor, new_tensor);
+    _BRY::recycleTensor<DIM>(std::move(new_tensor));
+}
 
-    return Polynomial<DIM, BASIS>(std::move(derivative_tensor_orig_deg));
+template <std::size_t DIM, BRY::Basis BASIS>
+BRY::Polynomial<DIM, BASIS> BRY::Polynomial<DIM, BASIS>::reparameterize(const std::array<bry_float_t, DIM>& shift, const std::array<bry_float_t, DIM>& scale) const {
+    Polynomial<DIM, BASIS> result(*this);
+    result.reparameterizeInPlace(shift, scale);
+    return result;
 }
 
 template <std::size_t DIM, BRY::Basis BASIS>
-BRY::Polynomial<DIM, BASIS> BRY::Polynomial<DIM, BASIS>::liftDegree(bry_int_t raised_deg) const {
-    #ifdef BRY_ENABLE_BOUNDS_CHECK
-        ASSERT(raised_deg >= degree(), "Raised degree is smaller than current degree");
-    #endif
-    return Polynomial<DIM, BASIS>(_BRY::expandToMatchSize<DIM>(m_tensor, raised_deg + 1));
+void BRY::Polynomial<DIM, BASIS>::reparameterizeInPlace(const std::array<bry_float_t, DIM>& shift, const std::array<bry_float_t, DIM>& scale) {
+    static_assert(BASIS == Basis::Power, "Affine reparameterization is only supported in the power basis");
+    BRY_PROBE(Reparameterize, m_tensor.size());
+
+    _BRY::reparameterizeCoefficients<DIM>(m_tensor.data(), degree() + 1, shift, scale);
 }
 
 template <std::size_t DIM>
@@ -272,13 +568,17 @@ const Eigen::Tensor<BRY::bry_float_t, DIM>& BRY::Polynomial<DIM, BASIS>::tensor(
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator+(BRY::bry_float_t scalar, const BRY::Polynomial<DIM, BRY::Basis::Power>& p) {
-    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = p.tensor();
+    BRY_PROBE(Add, p.nMonomials());
+    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p.tensor().dimensions());
+    BRY_PROBE_BYTES(new_tensor.size() * sizeof(BRY::bry_float_t));
+    new_tensor = p.tensor();
     *new_tensor.data() += scalar;
     return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(new_tensor));
 }
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator+(const BRY::Polynomial<DIM, BRY::Basis::Power>& p_1, const BRY::Polynomial<DIM, BRY::Basis::Power>& p_2) {
+    BRY_PROBE(Add, p_1.nMonomials() + p_2.nMonomials());
     const BRY::Polynomial<DIM, BRY::Basis::Power>* p_big;
     const BRY::Polynomial<DIM, BRY::Basis::Power>* p_small;
     if ((p_1.degree() > p_2.degree())) {
@@ -289,32 +589,49 @@ BRY::Polynomial<DIM, BRY::Basis::Power> operator+(const BRY::Polynomial<DIM, BRY
         p_small = &p_1;
     }
 
-    std::array<std::pair<BRY::bry_int_t, BRY::bry_int_t>, DIM> paddings;
-    for (std::pair<BRY::bry_int_t, BRY::bry_int_t>& pads : paddings) {
-        pads.first = 0;
-        pads.second = p_big->degree() - p_small->degree();
-    }
-
-    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = p_small->tensor().pad(paddings);
-    new_tensor += p_big->tensor();
+    // Add the smaller polynomial into the leading block of the larger one
+    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p_big->tensor().dimensions());
+    new_tensor = p_big->tensor();
+    new_tensor.slice(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0), p_small->tensor().dimensions()) += p_small->tensor();
+    BRY_PROBE_BYTES(new_tensor.size() * sizeof(BRY::bry_float_t));
     BRY::Polynomial<DIM, BRY::Basis::Power> p_new(std::move(new_tensor));
     return p_new;
 }
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator-(const BRY::Polynomial<DIM, BRY::Basis::Power>& p) {
-    return BRY::Polynomial<DIM, BRY::Basis::Power>(-p.tensor());
+    BRY_PROBE(Negate, p.nMonomials());
+    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p.tensor().dimensions());
+    BRY_PROBE_BYTES(new_tensor.size() * sizeof(BRY::bry_float_t));
+    new_tensor = -p.tensor();
+    return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(new_tensor));
 }
 
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator-(const BRY::Polynomial<DIM, BRY::Basis::Power>& p_1, const BRY::Polynomial<DIM, BRY::Basis::Power>& p_2) {
-    return p_1 + -p_2;
+    BRY_PROBE(Subtract, p_1.nMonomials() + p_2.nMonomials());
+
+    // Subtract directly into a copy of the larger polynomial instead of materializing `-p_2`
+    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(BRY::makeUniformArray<BRY::bry_int_t, DIM>(std::max(p_1.degree(), p_2.degree()) + 1));
+    if (p_1.degree() >= p_2.degree()) {
+        new_tensor = p_1.tensor();
+        new_tensor.slice(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0), p_2.tensor().dimensions()) -= p_2.tensor();
+    } else {
+        new_tensor = -p_2.tensor();
+        new_tensor.slice(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0), p_1.tensor().dimensions()) += p_1.tensor();
+    }
+    BRY_PROBE_BYTES(new_tensor.size() * sizeof(BRY::bry_float_t));
+    return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(new_tensor));
 }
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator*(BRY::bry_float_t scalar, const BRY::Polynomial<DIM, BRY::Basis::Power>& p) {
-    return BRY::Polynomial<DIM, BRY::Basis::Power>(scalar * p.tensor());
+    BRY_PROBE(Scale, p.nMonomials());
+    Eigen::Tensor<BRY::bry_float_t, DIM> new_tensor = _BRY::makeTensor<DIM>(p.tensor().dimensions());
+    BRY_PROBE_BYTES(new_tensor.size() * sizeof(BRY::bry_float_t));
+    new_tensor = scalar * p.tensor();
+    return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(new_tensor));
 }
 
 template <std::size_t DIM>
@@ -322,64 +639,69 @@ BRY::Polynomial<DIM, BRY::Basis::Power> operator*(const BRY::Polynomial<DIM, BRY
     return scalar * p;
 }
 
-/* TODO: Make this faster */
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator*(const BRY::Polynomial<DIM, BRY::Basis::Power>& p_1, const BRY::Polynomial<DIM, BRY::Basis::Power>& p_2) {
-
-    BRY::bry_int_t desired_size = p_1.degree() + p_2.degree() + 1;
-
-    Eigen::Tensor<BRY::bry_float_t, DIM> p_1_tensor_rszd = _BRY::expandToMatchSize<DIM>(p_1.tensor(), desired_size);
-    Eigen::Tensor<BRY::bry_float_t, DIM> p_2_tensor_rszd = _BRY::expandToMatchSize<DIM>(p_2.tensor(), desired_size);
-
-    std::array<BRY::bry_int_t, DIM> dimensions;
-    for (std::size_t i = 0; i < DIM; ++i)
-        dimensions[i] = i;
-
-    Eigen::Tensor<BRY::bry_complex_t, DIM> tensor_1_fft = p_1_tensor_rszd.template fft<Eigen::BothParts, Eigen::FFT_FORWARD>(dimensions);
-    Eigen::Tensor<BRY::bry_complex_t, DIM> tensor_2_fft = p_2_tensor_rszd.template fft<Eigen::BothParts, Eigen::FFT_FORWARD>(dimensions);
-    Eigen::Tensor<BRY::bry_complex_t, DIM> product_fft = tensor_1_fft * tensor_2_fft;
-
-    Eigen::Tensor<BRY::bry_float_t, DIM> result = product_fft.template fft<Eigen::RealPart, Eigen::FFT_REVERSE>(dimensions);
-    return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(result));
+    BRY_PROBE(Multiply, p_1.nMonomials() + p_2.nMonomials());
+    BRY::Polynomial<DIM, BRY::Basis::Power> product(BRY::Multiplication<DIM>::multiply(p_1.tensor(), p_2.tensor()));
+    BRY_PROBE_BYTES(product.nMonomials() * sizeof(BRY::bry_float_t));
+    return product;
 }
 
 template <std::size_t DIM>
 BRY::Polynomial<DIM, BRY::Basis::Power> operator^(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, BRY::bry_int_t exp) {
-
-    if (exp == 0) {
-        Eigen::Tensor<BRY::bry_float_t, DIM> scalar_t(makeUniformArray<BRY::bry_int_t, DIM>(1));
-        *scalar_t.data() = 1;
-        return BRY::Polynomial<DIM, BRY::Basis::Power>(scalar_t);
-    }
-
-    BRY::bry_int_t desired_size = exp * p.degree() + 1;
-
-    Eigen::Tensor<BRY::bry_float_t, DIM> p_tensor_rszd = _BRY::expandToMatchSize<DIM>(p.tensor(), desired_size);
-
-    std::array<BRY::bry_int_t, DIM> dimensions;
-    for (std::size_t i = 0; i < DIM; ++i)
-        dimensions[i] = i;
-
-    Eigen::Tensor<BRY::bry_complex_t, DIM> tensor_fft = p_tensor_rszd.template fft<Eigen::BothParts, Eigen::FFT_FORWARD>(dimensions);
-    Eigen::Tensor<BRY::bry_complex_t, DIM> exp_fft = tensor_fft.pow(static_cast<BRY::bry_float_t>(exp));
-
-    Eigen::Tensor<BRY::bry_float_t, DIM> result = exp_fft .template fft<Eigen::RealPart, Eigen::FFT_REVERSE>(dimensions);
-    return BRY::Polynomial<DIM, BRY::Basis::Power>(std::move(result));
+    BRY_PROBE(Power, p.nMonomials());
+    BRY::Polynomial<DIM, BRY::Basis::Power> power(BRY::Multiplication<DIM>::power(p.tensor(), exp));
+    BRY_PROBE_BYTES(power.nMonomials() * sizeof(BRY::bry_float_t));
+    return power;
 }
 
 template <std::size_t DIM, BRY::Basis FROM_BASIS, BRY::Basis TO_BASIS>
 BRY::Polynomial<DIM, TO_BASIS> BRY::transform(const Polynomial<DIM, FROM_BASIS>& p, const Matrix& transform_matrix) {
-    bry_int_t new_size = static_cast<bry_int_t>(std::pow(transform_matrix.rows(), 1.0 / static_cast<bry_float_t>(DIM)));
-    if (pow(new_size, DIM) < transform_matrix.rows())
-        new_size += 1;
+    BRY_PROBE(Transform, p.nMonomials());
+    BRY_PROBE_BYTES(transform_matrix.rows() * sizeof(bry_float_t));
+    return _BRY::transformVectorized<DIM, TO_BASIS>(p, transform_matrix);
+}
 
-    Eigen::Tensor<bry_float_t, DIM> tensor(makeUniformArray<bry_int_t, DIM>(new_size));
-    tensor.setZero();
+template <std::size_t DIM, BRY::Basis FROM_BASIS, BRY::Basis TO_BASIS>
+BRY::Polynomial<DIM, TO_BASIS> BRY::transform(const Polynomial<DIM, FROM_BASIS>& p, const SparseMatrix& transform_matrix) {
+    BRY_PROBE(Transform, p.nMonomials());
+    BRY_PROBE_BYTES(transform_matrix.rows() * sizeof(bry_float_t));
+    return _BRY::transformVectorized<DIM, TO_BASIS>(p, transform_matrix);
+}
 
-    Eigen::Map<const Vector> p_vec(p.tensor().data(), p.nMonomials());
-    Eigen::Map<Vector> p_vec_tf(tensor.data(), transform_matrix.rows());
+template <std::size_t DIM, BRY::Basis FROM_BASIS, BRY::Basis TO_BASIS>
+BRY::Polynomial<DIM, TO_BASIS> BRY::transform(const Polynomial<DIM, FROM_BASIS>& p, const DegreeChangeTransform<DIM>& transformation) {
+    BRY_PROBE(Transform, p.nMonomials());
+    BRY::Polynomial<DIM, TO_BASIS> transformed(transformation.apply(p.tensor()));
+    BRY_PROBE_BYTES(transformed.nMonomials() * sizeof(bry_float_t));
+    return transformed;
+}
 
-    p_vec_tf = transform_matrix * p_vec;
+template <std::size_t DIM, BRY::Basis FROM_BASIS, BRY::Basis TO_BASIS>
+BRY::Polynomial<DIM, TO_BASIS> BRY::transform(const Polynomial<DIM, FROM_BASIS>& p, const KroneckerTransform<DIM>& transformation) {
+    BRY_PROBE(Transform, p.nMonomials());
+    BRY::Polynomial<DIM, TO_BASIS> transformed(transformation.apply(p.tensor()));
+    BRY_PROBE_BYTES(transformed.nMonomials() * sizeof(bry_float_t));
+    return transformed;
+}
 
-    return BRY::Polynomial<DIM, TO_BASIS>(std::move(tensor));
+template <std::size_t DIM>
+void BRY::multiply(const Polynomial<DIM, Basis::Power>& p_1, const Polynomial<DIM, Basis::Power>& p_2, Polynomial<DIM, Basis::Power>& dest) {
+    BRY_PROBE(Multiply, p_1.nMonomials() + p_2.nMonomials());
+    Multiplication<DIM>::multiplyInto(p_1.tensor(), p_2.tensor(), dest.m_tensor);
+}
+
+template <std::size_t DIM>
+std::vector<BRY::Polynomial<DIM, BRY::Basis::Power>> BRY::powers(const Polynomial<DIM, Basis::Power>& p, bry_int_t max_exp) {
+    BRY_PROBE(Powers, p.nMonomials());
+    std::vector<Eigen::Tensor<bry_float_t, DIM>> tensors = Multiplication<DIM>::powers(p.tensor(), max_exp);
+
+    std::vector<Polynomial<DIM, Basis::Power>> result;
+    result.reserve(tensors.size());
+    for (Eigen::Tensor<bry_float_t, DIM>& tensor : tensors)
+        result.emplace_back(std::move(tensor));
+    BRY_PROBE_BYTES(std::accumulate(result.begin(), result.end(), std::size_t(0), [] (std::size_t bytes, const Polynomial<DIM, Basis::Power>& power) {
+        return bytes + power.nMonomials() * sizeof(bry_float_t);
+    }));
+    return result;
 }
@@ -1,26 +1,61 @@
 #pragma once
 
 #include "Shrink.h"
+#include "BernsteinTransform.h"
+#include "Operations.h"
 
 #include "lemon/Logging.h"
 
 #include <Eigen/Core>
 #include <unsupported/Eigen/CXX11/Tensor>
 
+namespace _BRY {
+    /// @brief Range of the Bernstein coefficients of the terms that are pruned when reducing `p` to `new_degree`. By the convex 
+    /// hull property of the Bernstein basis, the pruned part of `p` lies within this range everywhere on [0, 1]^DIM
+    template <std::size_t DIM>
+    std::pair<BRY::bry_float_t, BRY::bry_float_t> prunedTermsRange(const BRY::Polynomial<DIM, BRY::Basis::Power>& p, BRY::bry_int_t new_degree) {
+        Eigen::Tensor<BRY::bry_float_t, DIM> pruned_tensor = makeTensor<DIM>(p.tensor().dimensions());
+        pruned_tensor = p.tensor();
+        pruned_tensor.slice(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0), BRY::makeUniformArray<BRY::bry_int_t, DIM>(new_degree + 1)).setZero();
+        BRY::Polynomial<DIM, BRY::Basis::Power> pruned(std::move(pruned_tensor));
+
+        std::shared_ptr<const BRY::KroneckerTransform<DIM>> to_bernstein = BRY::BernsteinBasisTransform<DIM>::cachedPwrToBernTransform(p.degree());
+        BRY::Polynomial<DIM, BRY::Basis::Bernstein> pruned_bernstein = BRY::transform<DIM, BRY::Basis::Power, BRY::Basis::Bernstein>(pruned, *to_bernstein);
+
+        Eigen::Map<const BRY::Vector> coeffs(pruned_bernstein.tensor().data(), pruned_bernstein.nMonomials());
+        return std::make_pair(coeffs.minCoeff(), coeffs.maxCoeff());
+    }
+}
+
 template <std::size_t DIM>
-static BRY::Polynomial<DIM, Basis::Power> BRY::Shrink::pruneHigherOrder(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
+static BRY::Polynomial<DIM, BRY::Basis::Power> BRY::Shrink::pruneHigherOrder(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
+    BRY_ASSERT(new_degree >= 0, "Degree of the shrunken polynomial must be non-negative");
+    if (new_degree >= p.degree())
+        return p;
+
     std::array<bry_int_t, DIM> offsets = makeUniformArray<bry_int_t, DIM>(0);
-    std::array<bry_int_t, 2> extents = makeUniformArray<bry_int_t, DIM>(new_degree);
-    Eigen::Tensor<bry_float_t, DIM> shrunken_tensor = p.tensor().slice(offsets, extents);
+    std::array<bry_int_t, DIM> extents = makeUniformArray<bry_int_t, DIM>(new_degree + 1);
+    Eigen::Tensor<bry_float_t, DIM> shrunken_tensor = _BRY::makeTensor<DIM>(extents);
+    shrunken_tensor = p.tensor().slice(offsets, extents);
     return BRY::Polynomial<DIM, Basis::Power>(std::move(shrunken_tensor));
 }
 
 template <std::size_t DIM>
-static BRY::Polynomial<DIM, Basis::Power> BRY::Shrink::upperBound01(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
-    
+static BRY::Polynomial<DIM, BRY::Basis::Power> BRY::Shrink::upperBound01(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
+    Polynomial<DIM, Basis::Power> shrunken = pruneHigherOrder(p, new_degree);
+    if (new_degree >= p.degree())
+        return shrunken;
+
+    shrunken += _BRY::prunedTermsRange(p, new_degree).second;
+    return shrunken;
 }
 
 template <std::size_t DIM>
-static BRY::Polynomial<DIM, Basis::Power> BRY::Shrink::lowerBound01(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
+static BRY::Polynomial<DIM, BRY::Basis::Power> BRY::Shrink::lowerBound01(const Polynomial<DIM, Basis::Power>& p, bry_int_t new_degree) {
+    Polynomial<DIM, Basis::Power> shrunken = pruneHigherOrder(p, new_degree);
+    if (new_degree >= p.degree())
+        return shrunken;
 
-}
\ No newline at end of file
+    shrunken += _BRY::prunedTermsRange(p, new_degree).first;
+    return shrunken;
+}
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "SimplexPolynomial.h"
+#include "Operations.h"
+
+#include "lemon/Logging.h"
+
+#include <stdexcept>
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM>::SimplexPolynomial(bry_int_t degree)
+    : m_degree(degree)
+    , m_coeffs(Vector::Zero(nCoefficients(degree)))
+{}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM>::SimplexPolynomial(bry_int_t degree, const Vector& coefficients)
+    : m_degree(degree)
+    , m_coeffs(coefficients)
+{
+    if (m_coeffs.size() != nCoefficients(degree)) {
+        ERROR("Input vector dimension mismatch");
+        throw std::invalid_argument("Input vector dimension mismatch");
+    }
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM>::SimplexPolynomial(bry_int_t degree, Vector&& coefficients)
+    : m_degree(degree)
+    , m_coeffs(std::move(coefficients))
+{
+    if (m_coeffs.size() != nCoefficients(degree)) {
+        ERROR("Input vector dimension mismatch");
+        throw std::invalid_argument("Input vector dimension mismatch");
+    }
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM>::SimplexPolynomial(const Polynomial<DIM, Basis::Power>& p)
+    : m_degree(0)
+{
+    const Eigen::Tensor<bry_float_t, DIM>& tensor = p.tensor();
+
+    // Find the total degree
+    std::array<bry_int_t, DIM> idx{};
+    for (bry_int_t i = 0; i < tensor.size(); ++i) {
+        bry_int_t total_degree = 0;
+        for (bry_int_t e : idx)
+            total_degree += e;
+        if (tensor.data()[i] != 0.0)
+            m_degree = std::max(m_degree, total_degree);
+
+        for (std::size_t d = 0; d < DIM; ++d) {
+            if (++idx[d] < tensor.dimension(d))
+                break;
+            idx[d] = 0;
+        }
+    }
+
+    m_coeffs = Vector::Zero(nCoefficients(m_degree));
+    std::array<bry_int_t, DIM> exponents{};
+    for (bry_int_t r = 0; r < m_coeffs.size(); ++r, next(exponents)) {
+        bool in_box = true;
+        for (std::size_t d = 0; d < DIM; ++d)
+            in_box &= exponents[d] < tensor.dimension(d);
+        if (in_box)
+            m_coeffs[r] = tensor(exponents);
+    }
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SimplexPolynomial<DIM>::degree() const {
+    return m_degree;
+}
+
+template <std::size_t DIM>
+template <typename ... DEGS>
+BRY::bry_float_t& BRY::SimplexPolynomial<DIM>::coeff(DEGS ... exponents) {
+    static_assert(is_uniform_convertible_type<bry_int_t, DEGS ...>(), "All parameters passed to `coeff` must be degree type (`bry_int_t`)");
+    static_assert(sizeof...(DEGS) == DIM, "Number of exponents must match the dimension of the polynomial");
+    return coeff(makeArray<bry_int_t>(exponents ...));
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t& BRY::SimplexPolynomial<DIM>::coeff(const std::array<bry_int_t, DIM>& exponents) {
+    bry_int_t r = rank(exponents);
+    BRY_ASSERT(r < m_coeffs.size(), "Total degree of the exponents exceeds the degree of the polynomial");
+    return m_coeffs[r];
+}
+
+template <std::size_t DIM>
+template <typename ... DEGS>
+BRY::bry_float_t BRY::SimplexPolynomial<DIM>::coeff(DEGS ... exponents) const {
+    static_assert(is_uniform_convertible_type<bry_int_t, DEGS ...>(), "All parameters passed to `coeff` must be degree type (`bry_int_t`)");
+    static_assert(sizeof...(DEGS) == DIM, "Number of exponents must match the dimension of the polynomial");
+    return coeff(makeArray<bry_int_t>(exponents ...));
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SimplexPolynomial<DIM>::coeff(const std::array<bry_int_t, DIM>& exponents) const {
+    bry_int_t r = rank(exponents);
+    BRY_ASSERT(r < m_coeffs.size(), "Total degree of the exponents exceeds the degree of the polynomial");
+    return m_coeffs[r];
+}
+
+template <std::size_t DIM>
+template <typename ... FLTS>
+BRY::bry_float_t BRY::SimplexPolynomial<DIM>::operator()(FLTS ... x) const {
+    static_assert(is_uniform_convertible_type<bry_float_t, FLTS ...>(), "All parameters passed to `operator()` must be float type (`bry_float_t`)");
+    static_assert(sizeof...(FLTS) == DIM, "Number of x parameters must match the dimension of the polynomial");
+    return operator()(makeArray<bry_float_t>(x ...));
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SimplexPolynomial<DIM>::operator()(const std::array<bry_float_t, DIM>& x) const {
+    // Table of the powers of each variable
+    bry_int_t n = m_degree + 1;
+    std::vector<bry_float_t> powers(DIM * n);
+    for (std::size_t d = 0; d < DIM; ++d) {
+        bry_float_t* x_d_powers = powers.data() + d * n;
+        x_d_powers[0] = 1.0;
+        for (bry_int_t k = 1; k < n; ++k)
+            x_d_powers[k] = x_d_powers[k - 1] * x[d];
+    }
+
+    bry_float_t value = 0.0;
+    std::array<bry_int_t, DIM> exponents{};
+    for (bry_int_t r = 0; r < m_coeffs.size(); ++r, next(exponents)) {
+        bry_float_t term = m_coeffs[r];
+        for (std::size_t d = 0; d < DIM; ++d)
+            term *= powers[d * n + exponents[d]];
+        value += term;
+    }
+    return value;
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SimplexPolynomial<DIM>::operator()(const Eigen::Vector<bry_float_t, DIM>& x) const {
+    std::array<bry_float_t, DIM> x_arr;
+    for (std::size_t d = 0; d < DIM; ++d)
+        x_arr[d] = x[d];
+    return operator()(x_arr);
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> BRY::SimplexPolynomial<DIM>::derivative(bry_int_t dx_idx) const {
+    BRY_ASSERT(dx_idx < static_cast<bry_int_t>(DIM) && dx_idx >= 0, "Dimension index is out of bounds");
+
+    SimplexPolynomial<DIM> result(m_degree);
+    std::array<bry_int_t, DIM> exponents{};
+    for (bry_int_t r = 0; r < m_coeffs.size(); ++r, next(exponents)) {
+        if (exponents[dx_idx] == 0)
+            continue;
+
+        // Power rule
+        std::array<bry_int_t, DIM> derivative_exponents = exponents;
+        --derivative_exponents[dx_idx];
+        result.m_coeffs[rank(derivative_exponents)] = static_cast<bry_float_t>(exponents[dx_idx]) * m_coeffs[r];
+    }
+    return result;
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> BRY::SimplexPolynomial<DIM>::liftDegree(bry_int_t raised_deg) const {
+    BRY_ASSERT(raised_deg >= m_degree, "Raised degree is smaller than current degree");
+
+    // Terms are ordered by total degree, so the existing coefficients are a prefix of the raised coefficients
+    SimplexPolynomial<DIM> result(raised_deg);
+    result.m_coeffs.head(m_coeffs.size()) = m_coeffs;
+    return result;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SimplexPolynomial<DIM>::nMonomials() const {
+    return m_coeffs.size();
+}
+
+template <std::size_t DIM>
+const BRY::Vector& BRY::SimplexPolynomial<DIM>::coefficients() const {
+    return m_coeffs;
+}
+
+template <std::size_t DIM>
+BRY::Polynomial<DIM, BRY::Basis::Power> BRY::SimplexPolynomial<DIM>::toDense() const {
+    Polynomial<DIM, Basis::Power> p(m_degree);
+    std::array<bry_int_t, DIM> exponents{};
+    for (bry_int_t r = 0; r < m_coeffs.size(); ++r, next(exponents))
+        p.coeff(exponents) = m_coeffs[r];
+    return p;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SimplexPolynomial<DIM>::nCoefficients(bry_int_t degree) {
+    return binom(degree + DIM, DIM);
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SimplexPolynomial<DIM>::rank(const std::array<bry_int_t, DIM>& exponents) {
+    bry_int_t total_degree = 0;
+    for (bry_int_t e : exponents)
+        total_degree += e;
+
+    // Number of terms of smaller total degree
+    bry_int_t r = total_degree > 0 ? binom(total_degree - 1 + DIM, DIM) : 0;
+
+    // Number of terms of the same total degree that come first, i.e. that have a larger exponent at the first differing variable
+    bry_int_t remaining = total_degree;
+    for (std::size_t d = 0; d + 1 < DIM; ++d) {
+        remaining -= exponents[d];
+        if (remaining > 0)
+            r += binom(remaining + DIM - d - 2, DIM - d - 1);
+    }
+    return r;
+}
+
+template <std::size_t DIM>
+void BRY::SimplexPolynomial<DIM>::next(std::array<bry_int_t, DIM>& exponents) {
+    // Move one unit from the last nonzero exponent (excluding the last variable) to the following variable, gathering the tail there
+    bry_int_t tail = exponents[DIM - 1];
+    for (std::size_t d = DIM - 1; d-- > 0;) {
+        if (exponents[d] > 0) {
+            --exponents[d];
+            exponents[d + 1] = tail + 1;
+            for (std::size_t i = d + 2; i < DIM; ++i)
+                exponents[i] = 0;
+            return;
+        }
+        tail += exponents[d];
+    }
+
+    // Last term of the total degree, start the next total degree
+    bry_int_t total_degree = tail;
+    exponents.fill(0);
+    exponents[0] = total_degree + 1;
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator+(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2) {
+    const BRY::SimplexPolynomial<DIM>& p_big = p_1.degree() >= p_2.degree() ? p_1 : p_2;
+    const BRY::SimplexPolynomial<DIM>& p_small = p_1.degree() >= p_2.degree() ? p_2 : p_1;
+
+    BRY::Vector coeffs = p_big.coefficients();
+    coeffs.head(p_small.nMonomials()) += p_small.coefficients();
+    return BRY::SimplexPolynomial<DIM>(p_big.degree(), std::move(coeffs));
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator-(const BRY::SimplexPolynomial<DIM>& p) {
+    return BRY::SimplexPolynomial<DIM>(p.degree(), -p.coefficients());
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator-(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2) {
+    return p_1 + -p_2;
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(BRY::bry_float_t scalar, const BRY::SimplexPolynomial<DIM>& p) {
+    return BRY::SimplexPolynomial<DIM>(p.degree(), scalar * p.coefficients());
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(const BRY::SimplexPolynomial<DIM>& p, BRY::bry_float_t scalar) {
+    return scalar * p;
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator*(const BRY::SimplexPolynomial<DIM>& p_1, const BRY::SimplexPolynomial<DIM>& p_2) {
+    BRY::Vector coeffs = BRY::Vector::Zero(BRY::SimplexPolynomial<DIM>::nCoefficients(p_1.degree() + p_2.degree()));
+
+    // Exponents of the second factor in rank order
+    std::vector<std::array<BRY::bry_int_t, DIM>> exponents_2(p_2.nMonomials());
+    std::array<BRY::bry_int_t, DIM> exponents{};
+    for (std::array<BRY::bry_int_t, DIM>& e : exponents_2) {
+        e = exponents;
+        BRY::SimplexPolynomial<DIM>::next(exponents);
+    }
+
+    std::array<BRY::bry_int_t, DIM> exponents_1{};
+    for (BRY::bry_int_t i = 0; i < p_1.nMonomials(); ++i, BRY::SimplexPolynomial<DIM>::next(exponents_1)) {
+        BRY::bry_float_t coeff_1 = p_1.coefficients()[i];
+        if (coeff_1 == 0.0)
+            continue;
+
+        for (BRY::bry_int_t j = 0; j < p_2.nMonomials(); ++j) {
+            std::array<BRY::bry_int_t, DIM> product_exponents;
+            for (std::size_t d = 0; d < DIM; ++d)
+                product_exponents[d] = exponents_1[d] + exponents_2[j][d];
+            coeffs[BRY::SimplexPolynomial<DIM>::rank(product_exponents)] += coeff_1 * p_2.coefficients()[j];
+        }
+    }
+    return BRY::SimplexPolynomial<DIM>(p_1.degree() + p_2.degree(), std::move(coeffs));
+}
+
+template <std::size_t DIM>
+BRY::SimplexPolynomial<DIM> operator^(const BRY::SimplexPolynomial<DIM>& p, BRY::bry_int_t exp) {
+    BRY::SimplexPolynomial<DIM> result(0);
+    result.coeff(BRY::makeUniformArray<BRY::bry_int_t, DIM>(0)) = 1.0;
+
+    // Exponentiation by squaring
+    BRY::SimplexPolynomial<DIM> base = p;
+    while (exp > 0) {
+        if (exp & 1)
+            result = result * base;
+        exp >>= 1;
+        if (exp > 0)
+            base = base * base;
+    }
+    return result;
+}
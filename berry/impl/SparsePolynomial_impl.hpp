@@ -0,0 +1,316 @@
+#pragma once
+
+#include "SparsePolynomial.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM>::SparsePolynomial(const Polynomial<DIM, Basis::Power>& p) {
+    const Eigen::Tensor<bry_float_t, DIM>& tensor = p.tensor();
+
+    // The flattened (column-major) order of the tensor is the key order
+    std::array<bry_int_t, DIM> idx{};
+    for (bry_int_t i = 0; i < tensor.size(); ++i) {
+        if (tensor.data()[i] != 0.0) {
+            m_keys.push_back(pack(idx));
+            m_coeffs.push_back(tensor.data()[i]);
+        }
+
+        for (std::size_t d = 0; d < DIM; ++d) {
+            if (++idx[d] < tensor.dimension(d))
+                break;
+            idx[d] = 0;
+        }
+    }
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM>::SparsePolynomial(const std::vector<std::pair<std::array<bry_int_t, DIM>, bry_float_t>>& terms) {
+    std::vector<std::pair<Key, bry_float_t>> packed;
+    packed.reserve(terms.size());
+    for (const auto& term : terms)
+        packed.emplace_back(pack(term.first), term.second);
+    std::sort(packed.begin(), packed.end(), [] (const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    for (std::size_t i = 0; i < packed.size();) {
+        Key key = packed[i].first;
+        bry_float_t coeff = 0.0;
+        for (; i < packed.size() && packed[i].first == key; ++i)
+            coeff += packed[i].second;
+
+        if (coeff != 0.0) {
+            m_keys.push_back(key);
+            m_coeffs.push_back(coeff);
+        }
+    }
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SparsePolynomial<DIM>::degree() const {
+    bry_int_t max_exp = 0;
+    for (Key key : m_keys) {
+        for (std::size_t d = 0; d < DIM; ++d)
+            max_exp = std::max(max_exp, static_cast<bry_int_t>((key >> (d * s_field_bits)) & s_field_mask));
+    }
+    return max_exp;
+}
+
+template <std::size_t DIM>
+BRY::bry_int_t BRY::SparsePolynomial<DIM>::nTerms() const {
+    return m_keys.size();
+}
+
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> BRY::SparsePolynomial<DIM>::exponents(bry_int_t i) const {
+    BRY_ASSERT(i < nTerms(), "Term index is out of bounds");
+    return unpack(m_keys[i]);
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SparsePolynomial<DIM>::coefficient(bry_int_t i) const {
+    BRY_ASSERT(i < nTerms(), "Term index is out of bounds");
+    return m_coeffs[i];
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SparsePolynomial<DIM>::coeff(const std::array<bry_int_t, DIM>& exponents) const {
+    Key key = pack(exponents);
+    auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+    if (it == m_keys.end() || *it != key)
+        return 0.0;
+    return m_coeffs[std::distance(m_keys.begin(), it)];
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SparsePolynomial<DIM>::operator()(const std::array<bry_float_t, DIM>& x) const {
+    if (m_keys.empty())
+        return 0.0;
+
+    // Table of the powers of each variable
+    bry_int_t n = degree() + 1;
+    std::vector<bry_float_t> powers(DIM * n);
+    for (std::size_t d = 0; d < DIM; ++d) {
+        bry_float_t* x_d_powers = powers.data() + d * n;
+        x_d_powers[0] = 1.0;
+        for (bry_int_t k = 1; k < n; ++k)
+            x_d_powers[k] = x_d_powers[k - 1] * x[d];
+    }
+
+    bry_float_t value = 0.0;
+    for (std::size_t i = 0; i < m_keys.size(); ++i) {
+        bry_float_t term = m_coeffs[i];
+        for (std::size_t d = 0; d < DIM; ++d)
+            term *= powers[d * n + ((m_keys[i] >> (d * s_field_bits)) & s_field_mask)];
+        value += term;
+    }
+    return value;
+}
+
+template <std::size_t DIM>
+BRY::bry_float_t BRY::SparsePolynomial<DIM>::operator()(const Eigen::Vector<bry_float_t, DIM>& x) const {
+    std::array<bry_float_t, DIM> x_arr;
+    for (std::size_t d = 0; d < DIM; ++d)
+        x_arr[d] = x[d];
+    return operator()(x_arr);
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> BRY::SparsePolynomial<DIM>::derivative(bry_int_t dx_idx) const {
+    BRY_ASSERT(dx_idx < static_cast<bry_int_t>(DIM) && dx_idx >= 0, "Dimension index is out of bounds");
+
+    // Decrementing the exponent of the same variable in every key preserves the order
+    std::size_t shift = dx_idx * s_field_bits;
+    SparsePolynomial<DIM> result;
+    for (std::size_t i = 0; i < m_keys.size(); ++i) {
+        Key exp = (m_keys[i] >> shift) & s_field_mask;
+        if (exp == 0)
+            continue;
+        result.m_keys.push_back(m_keys[i] - (Key(1) << shift));
+        result.m_coeffs.push_back(static_cast<bry_float_t>(exp) * m_coeffs[i]);
+    }
+    return result;
+}
+
+template <std::size_t DIM>
+BRY::Polynomial<DIM, BRY::Basis::Power> BRY::SparsePolynomial<DIM>::toDense() const {
+    bry_int_t n = degree() + 1;
+    std::array<bry_int_t, DIM> dims;
+    dims.fill(n);
+    Eigen::Tensor<bry_float_t, DIM> tensor(dims);
+    tensor.setZero();
+
+    for (std::size_t i = 0; i < m_keys.size(); ++i) {
+        bry_int_t flat_idx = 0;
+        bry_int_t stride = 1;
+        for (std::size_t d = 0; d < DIM; ++d) {
+            flat_idx += stride * static_cast<bry_int_t>((m_keys[i] >> (d * s_field_bits)) & s_field_mask);
+            stride *= n;
+        }
+        tensor.data()[flat_idx] = m_coeffs[i];
+    }
+    return Polynomial<DIM, Basis::Power>(std::move(tensor));
+}
+
+template <std::size_t DIM>
+const std::vector<typename BRY::SparsePolynomial<DIM>::Key>& BRY::SparsePolynomial<DIM>::keys() const {
+    return m_keys;
+}
+
+template <std::size_t DIM>
+const std::vector<BRY::bry_float_t>& BRY::SparsePolynomial<DIM>::coefficients() const {
+    return m_coeffs;
+}
+
+template <std::size_t DIM>
+constexpr BRY::bry_int_t BRY::SparsePolynomial<DIM>::maxExponent() {
+    return static_cast<bry_int_t>(std::min<Key>(s_field_mask, std::numeric_limits<bry_int_t>::max()));
+}
+
+template <std::size_t DIM>
+typename BRY::SparsePolynomial<DIM>::Key BRY::SparsePolynomial<DIM>::pack(const std::array<bry_int_t, DIM>& exponents) {
+    Key key = 0;
+    for (std::size_t d = 0; d < DIM; ++d) {
+        BRY_ASSERT(exponents[d] >= 0 && exponents[d] <= maxExponent(), "Exponent does not fit in the packed key");
+        key |= static_cast<Key>(exponents[d]) << (d * s_field_bits);
+    }
+    return key;
+}
+
+template <std::size_t DIM>
+std::array<BRY::bry_int_t, DIM> BRY::SparsePolynomial<DIM>::unpack(Key key) {
+    std::array<bry_int_t, DIM> exponents;
+    for (std::size_t d = 0; d < DIM; ++d)
+        exponents[d] = static_cast<bry_int_t>((key >> (d * s_field_bits)) & s_field_mask);
+    return exponents;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator+(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2) {
+    BRY::SparsePolynomial<DIM> result;
+    result.m_keys.reserve(p_1.m_keys.size() + p_2.m_keys.size());
+    result.m_coeffs.reserve(p_1.m_keys.size() + p_2.m_keys.size());
+
+    // Merge the sorted terms
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < p_1.m_keys.size() || j < p_2.m_keys.size()) {
+        typename BRY::SparsePolynomial<DIM>::Key key;
+        BRY::bry_float_t coeff;
+        if (j == p_2.m_keys.size() || (i < p_1.m_keys.size() && p_1.m_keys[i] < p_2.m_keys[j])) {
+            key = p_1.m_keys[i];
+            coeff = p_1.m_coeffs[i++];
+        } else if (i == p_1.m_keys.size() || p_2.m_keys[j] < p_1.m_keys[i]) {
+            key = p_2.m_keys[j];
+            coeff = p_2.m_coeffs[j++];
+        } else {
+            key = p_1.m_keys[i];
+            coeff = p_1.m_coeffs[i++] + p_2.m_coeffs[j++];
+        }
+
+        if (coeff != 0.0) {
+            result.m_keys.push_back(key);
+            result.m_coeffs.push_back(coeff);
+        }
+    }
+    return result;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator-(const BRY::SparsePolynomial<DIM>& p) {
+    return -1.0 * p;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator-(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2) {
+    return p_1 + -p_2;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(BRY::bry_float_t scalar, const BRY::SparsePolynomial<DIM>& p) {
+    if (scalar == 0.0)
+        return BRY::SparsePolynomial<DIM>();
+
+    BRY::SparsePolynomial<DIM> result = p;
+    for (BRY::bry_float_t& coeff : result.m_coeffs)
+        coeff *= scalar;
+    return result;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(const BRY::SparsePolynomial<DIM>& p, BRY::bry_float_t scalar) {
+    return scalar * p;
+}
+
+template <std::size_t DIM>
+BRY::SparsePolynomial<DIM> operator*(const BRY::SparsePolynomial<DIM>& p_1, const BRY::SparsePolynomial<DIM>& p_2) {
+    using Key = typename BRY::SparsePolynomial<DIM>::Key;
+
+    BRY_ASSERT(p_1.degree() + p_2.degree() <= BRY::SparsePolynomial<DIM>::maxExponent(), "Product exponents do not fit in the packed key");
+
+    // One heap entry per term of the smaller factor, each walking through the terms of the larger factor
+    const BRY::SparsePolynomial<DIM>& p_rows = p_1.nTerms() <= p_2.nTerms() ? p_1 : p_2;
+    const BRY::SparsePolynomial<DIM>& p_cols = p_1.nTerms() <= p_2.nTerms() ? p_2 : p_1;
+
+    BRY::SparsePolynomial<DIM> result;
+    if (p_rows.m_keys.empty())
+        return result;
+
+    // (key, row, column), ordered such that the smallest key is on top
+    typedef std::tuple<Key, std::size_t, std::size_t> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (std::size_t row = 0; row < p_rows.m_keys.size(); ++row)
+        heap.emplace(p_rows.m_keys[row] + p_cols.m_keys[0], row, 0);
+
+    // Products come out in key order, so equal keys are adjacent
+    while (!heap.empty()) {
+        auto [key, row, col] = heap.top();
+        heap.pop();
+
+        BRY::bry_float_t product = p_rows.m_coeffs[row] * p_cols.m_coeffs[col];
+        if (!result.m_keys.empty() && result.m_keys.back() == key) {
+            result.m_coeffs.back() += product;
+        } else {
+            // Drop a previous term that cancelled
+            if (!result.m_keys.empty() && result.m_coeffs.back() == 0.0) {
+                result.m_keys.pop_back();
+                result.m_coeffs.pop_back();
+            }
+            result.m_keys.push_back(key);
+            result.m_coeffs.push_back(product);
+        }
+
+        if (++col < p_cols.m_keys.size())
+            heap.emplace(p_rows.m_keys[row] + p_cols.m_keys[col], row, col);
+    }
+
+    if (result.m_coeffs.back() == 0.0) {
+        result.m_keys.pop_back();
+        result.m_coeffs.pop_back();
+    }
+    return result;
+}
+
+template <std::size_t DIM>
+std::ostream& operator<<(std::ostream& os, const BRY::SparsePolynomial<DIM>& p) {
+    if (p.nTerms() == 0)
+        return os << LMN_LOG_BYELLOW('0');
+
+    for (BRY::bry_int_t i = 0; i < p.nTerms(); ++i) {
+        if (i > 0)
+            os << LMN_LOG_WHITE(" + ");
+
+        os << LMN_LOG_BYELLOW(p.coefficient(i));
+        std::array<BRY::bry_int_t, DIM> exponents = p.exponents(i);
+        for (std::size_t dim = 0; dim < DIM; ++dim) {
+            if (exponents[dim] > 0)
+                os << LMN_LOG_WHITE("(x" << dim << "^") << LMN_LOG_BGREEN(exponents[dim]) << LMN_LOG_WHITE(")");
+        }
+    }
+    return os;
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "TaskScheduler.h"
+
+#include "lemon/Logging.h"
+
+#include <algorithm>
+#include <optional>
+
+BRY::TaskScheduler::TaskScheduler(std::size_t n_threads)
+    : m_stop(false)
+    , m_queued(0)
+{
+    n_threads = std::max<std::size_t>(n_threads, 1);
+    for (std::size_t i = 0; i < n_threads; ++i)
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+
+    // Queue 0 belongs to the waiting (non-worker) threads
+    m_workers.reserve(n_threads - 1);
+    for (std::size_t i = 1; i < n_threads; ++i)
+        m_workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+}
+
+BRY::TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_sleep_cv.notify_all();
+    for (std::thread& worker : m_workers)
+        worker.join();
+}
+
+std::size_t BRY::TaskScheduler::nThreads() const {
+    return m_queues.size();
+}
+
+template <typename FUNC>
+void BRY::TaskScheduler::parallelFor(bry_int_t begin, bry_int_t end, FUNC&& fn, bry_int_t grain) {
+    if (end <= begin)
+        return;
+
+    grain = std::max<bry_int_t>(grain, 1);
+    bry_int_t n_tasks = (end - begin + grain - 1) / grain;
+
+    // Nothing to distribute
+    if (n_tasks == 1 || nThreads() == 1) {
+        for (bry_int_t i = begin; i < end; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<bry_int_t> remaining(n_tasks);
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+
+    // Submit in reverse so that the owner runs the first chunks first and thieves take the last chunks
+    for (bry_int_t t = n_tasks - 1; t >= 0; --t) {
+        bry_int_t chunk_begin = begin + t * grain;
+        bry_int_t chunk_end = std::min(end, chunk_begin + grain);
+        submit([&, chunk_begin, chunk_end] {
+            try {
+                for (bry_int_t i = chunk_begin; i < chunk_end; ++i)
+                    fn(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+            remaining.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    // Help execute tasks until every chunk is complete
+    std::size_t queue_idx = localQueue();
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!tryRunTask(queue_idx))
+            std::this_thread::yield();
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+template <typename T, typename FUNC>
+std::vector<T> BRY::TaskScheduler::parallelMap(bry_int_t n, FUNC&& fn, bry_int_t grain) {
+    // Results do not need to be default constructible
+    std::vector<std::optional<T>> slots(n);
+    parallelFor(0, n, [&] (bry_int_t i) {
+        slots[i].emplace(fn(i));
+    }, grain);
+
+    std::vector<T> results;
+    results.reserve(n);
+    for (std::optional<T>& slot : slots)
+        results.push_back(std::move(*slot));
+    return results;
+}
+
+BRY::TaskScheduler& BRY::TaskScheduler::global() {
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+void BRY::TaskScheduler::submit(Task&& task) {
+    // Count the task before it becomes visible so that the count never drops below zero
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        ++m_queued;
+    }
+
+    WorkerQueue& queue = *m_queues[localQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    m_sleep_cv.notify_one();
+}
+
+bool BRY::TaskScheduler::tryRunTask(std::size_t queue_idx) {
+    Task task;
+
+    // Newest task from the local queue
+    {
+        WorkerQueue& queue = *m_queues[queue_idx];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+    }
+
+    // Oldest task from another queue
+    for (std::size_t i = 1; !task && i < m_queues.size(); ++i) {
+        WorkerQueue& queue = *m_queues[(queue_idx + i) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task)
+        return false;
+
+    --m_queued;
+    task();
+    return true;
+}
+
+std::size_t BRY::TaskScheduler::localQueue() const {
+    return s_worker_scheduler == this ? s_worker_queue : 0;
+}
+
+void BRY::TaskScheduler::workerLoop(std::size_t queue_idx) {
+    s_worker_scheduler = this;
+    s_worker_queue = queue_idx;
+
+    while (true) {
+        if (tryRunTask(queue_idx))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cv.wait(lock, [this] { return m_stop || m_queued > 0; });
+        if (m_stop)
+            return;
+    }
+}
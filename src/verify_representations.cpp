@@ -0,0 +1,200 @@
+#include "berry/Polynomial.h"
+#include "berry/SparsePolynomial.h"
+#include "berry/SimplexPolynomial.h"
+#include "berry/FixedPolynomial.h"
+#include "berry/PolynomialExpression.h"
+#include "berry/Shrink.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace BRY;
+
+/* Compares the alternative polynomial representations (sparse, simplex, fixed degree and lazy expressions) and the Shrink bounds
+    against the dense `Polynomial` on random inputs. The exit code is 1 if any result does not match
+*/
+
+/* Relative tolerance of a matching evaluation */
+constexpr bry_float_t tolerance = 1.0e-9;
+
+/* Number of random points each comparison is evaluated at */
+constexpr int n_points = 16;
+
+static std::mt19937 s_rng(7);
+static std::size_t s_checks = 0;
+static std::size_t s_failures = 0;
+
+void check(bool condition, const std::string& name, std::size_t dim) {
+    ++s_checks;
+    if (!condition) {
+        std::cout << "FAILED: " << name << " (DIM " << dim << ")" << std::endl;
+        ++s_failures;
+    }
+}
+
+bool near(bry_float_t value, bry_float_t expected) {
+    return std::abs(value - expected) <= tolerance * std::max<bry_float_t>(1.0, std::abs(expected));
+}
+
+template <std::size_t DIM>
+std::array<bry_float_t, DIM> randomPoint(bry_float_t lower, bry_float_t upper) {
+    std::uniform_real_distribution<bry_float_t> distribution(lower, upper);
+    std::array<bry_float_t, DIM> x;
+    for (bry_float_t& x_d : x)
+        x_d = distribution(s_rng);
+    return x;
+}
+
+/// @brief Random dense polynomial, with about a third of the coefficients set to zero if `sparse` is true
+template <std::size_t DIM>
+Polynomial<DIM> randomPolynomial(bry_int_t degree, bool sparse = false) {
+    std::uniform_real_distribution<bry_float_t> distribution(-1.0, 1.0);
+    Eigen::Tensor<bry_float_t, DIM> tensor(makeUniformArray<bry_int_t, DIM>(degree + 1));
+    for (bry_int_t i = 0; i < tensor.size(); ++i)
+        tensor.data()[i] = (sparse && i % 3 == 1) ? 0.0 : distribution(s_rng);
+    return Polynomial<DIM>(std::move(tensor));
+}
+
+/// @brief Compare two polynomial-like objects at random points in [-1, 1]^DIM
+template <std::size_t DIM, typename P, typename EXPECTED>
+void compare(const P& p, const EXPECTED& expected, const std::string& name) {
+    bool match = true;
+    for (int i = 0; i < n_points; ++i) {
+        std::array<bry_float_t, DIM> x = randomPoint<DIM>(-1.0, 1.0);
+        match &= near(p(x), expected(x));
+    }
+    check(match, name, DIM);
+}
+
+template <std::size_t DIM>
+void verifySparse(bry_int_t degree) {
+    Polynomial<DIM> p = randomPolynomial<DIM>(degree, true);
+    Polynomial<DIM> q = randomPolynomial<DIM>(degree + 1, true);
+    SparsePolynomial<DIM> s_p(p);
+    SparsePolynomial<DIM> s_q(q);
+
+    compare<DIM>(s_p, p, "sparse evaluate");
+    compare<DIM>(s_p.toDense(), p, "sparse toDense");
+    compare<DIM>(s_p + s_q, p + q, "sparse add");
+    compare<DIM>(s_p - s_q, p - q, "sparse subtract");
+    compare<DIM>(-s_p, -p, "sparse negate");
+    compare<DIM>(2.5 * s_p, 2.5 * p, "sparse scale");
+    compare<DIM>(s_p * s_q, p * q, "sparse multiply");
+    for (std::size_t d = 0; d < DIM; ++d)
+        compare<DIM>(s_p.derivative(d), p.derivative(d), "sparse derivative");
+    check(s_p.degree() == p.degree(), "sparse degree", DIM);
+}
+
+template <std::size_t DIM>
+void verifySimplex(bry_int_t degree) {
+    std::normal_distribution<bry_float_t> distribution;
+    Vector coefficients_1(SimplexPolynomial<DIM>::nCoefficients(degree));
+    Vector coefficients_2(SimplexPolynomial<DIM>::nCoefficients(degree - 1));
+    for (bry_float_t& c : coefficients_1)
+        c = distribution(s_rng);
+    for (bry_float_t& c : coefficients_2)
+        c = distribution(s_rng);
+
+    SimplexPolynomial<DIM> s_p(degree, coefficients_1);
+    SimplexPolynomial<DIM> s_q(degree - 1, coefficients_2);
+    Polynomial<DIM> p = s_p.toDense();
+    Polynomial<DIM> q = s_q.toDense();
+
+    compare<DIM>(s_p, p, "simplex evaluate");
+    compare<DIM>(s_p + s_q, p + q, "simplex add");
+    compare<DIM>(s_p - s_q, p - q, "simplex subtract");
+    compare<DIM>(-s_p, -p, "simplex negate");
+    compare<DIM>(2.5 * s_p, 2.5 * p, "simplex scale");
+    compare<DIM>(s_p * s_q, p * q, "simplex multiply");
+    compare<DIM>(s_q ^ 3, q ^ 3, "simplex power");
+    compare<DIM>(s_p.liftDegree(degree + 2), p, "simplex liftDegree");
+    for (std::size_t d = 0; d < DIM; ++d)
+        compare<DIM>(s_p.derivative(d), p.derivative(d), "simplex derivative");
+
+    // Rank and next enumerate the exponents in the same order
+    std::array<bry_int_t, DIM> exponents{};
+    bool ordered = true;
+    for (bry_int_t r = 0; r < s_p.nMonomials(); ++r) {
+        ordered &= SimplexPolynomial<DIM>::rank(exponents) == r;
+        SimplexPolynomial<DIM>::next(exponents);
+    }
+    check(ordered, "simplex rank", DIM);
+    check((SimplexPolynomial<DIM>(p).coefficients() - coefficients_1).norm() == 0.0, "simplex from dense", DIM);
+}
+
+template <std::size_t DIM, std::size_t DEG_1, std::size_t DEG_2>
+void verifyFixed() {
+    Polynomial<DIM> p = randomPolynomial<DIM>(DEG_1);
+    Polynomial<DIM> q = randomPolynomial<DIM>(DEG_2);
+    FixedPolynomial<DIM, DEG_1> f_p(p);
+    FixedPolynomial<DIM, DEG_2> f_q(q);
+    FixedPolynomial<DIM, DEG_1> f_p_2(randomPolynomial<DIM>(DEG_1));
+
+    compare<DIM>(f_p, p, "fixed evaluate");
+    compare<DIM>(f_p.toDense(), p, "fixed toDense");
+    compare<DIM>(f_p + f_p_2, p + f_p_2.toDense(), "fixed add");
+    compare<DIM>(f_p - f_p_2, p - f_p_2.toDense(), "fixed subtract");
+    compare<DIM>(-f_p, -p, "fixed negate");
+    compare<DIM>(2.5 * f_p, 2.5 * p, "fixed scale");
+    compare<DIM>(f_p * f_q, p * q, "fixed multiply");
+    for (std::size_t d = 0; d < DIM; ++d)
+        compare<DIM>(f_p.derivative(d), p.derivative(d), "fixed derivative");
+}
+
+template <std::size_t DIM>
+void verifyLazy(bry_int_t degree) {
+    Polynomial<DIM> x = randomPolynomial<DIM>(degree);
+    Polynomial<DIM> y = randomPolynomial<DIM>(degree + 2);
+    Polynomial<DIM> z = randomPolynomial<DIM>(degree - 1);
+
+    Polynomial<DIM> lazy_result = 2.0 * lazy(x) + 3.0 * lazy(y) - z + 1.0;
+    Polynomial<DIM> dense_result = 1.0 + (2.0 * x + 3.0 * y - z);
+    compare<DIM>(lazy_result, dense_result, "lazy linear combination");
+    check(lazy_result.degree() == dense_result.degree(), "lazy degree", DIM);
+
+    Polynomial<DIM> lazy_negated = -(lazy(x) - lazy(y)) * 0.5 - 2.0;
+    compare<DIM>(lazy_negated, -2.0 + (-(x - y) * 0.5), "lazy negate");
+}
+
+template <std::size_t DIM>
+void verifyShrink(bry_int_t degree, bry_int_t new_degree) {
+    Polynomial<DIM> p = randomPolynomial<DIM>(degree);
+    Polynomial<DIM> upper = Shrink::upperBound01(p, new_degree);
+    Polynomial<DIM> lower = Shrink::lowerBound01(p, new_degree);
+
+    // The bounds must hold everywhere on the unit box, including its vertices
+    bool bounded = true;
+    for (int i = 0; i < 64 * n_points; ++i) {
+        std::array<bry_float_t, DIM> x = randomPoint<DIM>(0.0, 1.0);
+        if (i < (1 << DIM)) {
+            for (std::size_t d = 0; d < DIM; ++d)
+                x[d] = (i >> d) & 1;
+        }
+        bry_float_t value = p(x);
+        bounded &= upper(x) >= value - tolerance && lower(x) <= value + tolerance;
+    }
+    check(bounded, "shrink bounds", DIM);
+    check(upper.degree() == new_degree && lower.degree() == new_degree, "shrink degree", DIM);
+}
+
+template <std::size_t DIM>
+void verify(bry_int_t degree) {
+    verifySparse<DIM>(degree);
+    verifySimplex<DIM>(degree);
+    verifyFixed<DIM, 2, 3>();
+    verifyLazy<DIM>(degree);
+    verifyShrink<DIM>(degree + 1, degree - 1);
+}
+
+int main() {
+    verify<1>(6);
+    verify<2>(4);
+    verify<3>(3);
+    verify<4>(2);
+
+    std::cout << s_checks - s_failures << "/" << s_checks << " checks passed" << std::endl;
+    return s_failures > 0 ? 1 : 0;
+}